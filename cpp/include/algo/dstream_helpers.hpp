@@ -73,6 +73,66 @@ inline uint32_t lookup_B(const uint32_t blT, const uint32_t h) {
   return lookup_B_table.data[h * 32 + blT];
 }
 
+// Within an epoch, B takes one value for hanoi values in the uninvaded
+// window [h_begin, h_end) and another outside it, so one entry per blT
+// covers every h in a few bytes, instead of one entry per blT and h.
+template <uint32_t S> struct B_compact_table {
+  using B_t = smallest_unsigned_t<S>::type;
+  struct entry {
+    B_t B;
+    B_t B_uninvaded;
+    uint8_t h_begin;
+    uint8_t h_end;
+  };
+
+  constexpr B_compact_table() : data() {
+    constexpr uint32_t s = std::bit_width(S) - 1;
+    for (uint32_t blT = 0; blT < 32; ++blT) {
+      const uint32_t t = blT - std::min(s, blT); // Current epoch
+      const uint32_t blt = std::bit_width(t);    // Bit length of t
+      const bool epsilon_tau = std::bit_floor<uint32_t>(t << 1) > t + blt;
+      const uint32_t tau = blt - epsilon_tau;            // Current meta-epoch
+      const uint32_t t_0 = (1 << tau) - tau;             // Opening epoch
+      const uint32_t t_1 = (1 << (tau + 1)) - (tau + 1); // Next opening epoch
+      // epsilon_b holds where t < h + t_0 < t_1
+      const uint32_t h_begin = t + 1 > t_0 ? t + 1 - t_0 : 0;
+      const uint32_t h_end = std::max(t_1 - t_0, h_begin);
+      data[blT] = {
+          .B = B_t(std::max<uint32_t>(S >> (tau + 1), 1)),
+          .B_uninvaded = B_t(std::max<uint32_t>(S >> tau, 1)),
+          .h_begin = uint8_t(h_begin),
+          .h_end = uint8_t(h_end),
+      };
+    }
+  }
+  constexpr uint32_t get(const uint32_t blT, const uint32_t h) const {
+    const auto &entry = data[blT];
+    // h_begin <= h < h_end, as one unsigned comparison
+    const bool epsilon_b =
+        h - entry.h_begin < uint32_t(entry.h_end - entry.h_begin);
+    return epsilon_b ? entry.B_uninvaded : entry.B;
+  }
+
+  // equal to calc_B for every blT and h < 32
+  static constexpr bool check() {
+    const B_compact_table table{};
+    for (uint32_t h = 0; h < 32; ++h)
+      for (uint32_t blT = 0; blT < 32; ++blT)
+        if (table.get(blT, h) != calc_B<S>(blT, h))
+          return false;
+    return true;
+  }
+
+  entry data[32];
+};
+
+template <uint32_t S>
+inline uint32_t lookup_B_compact(const uint32_t blT, const uint32_t h) {
+  static_assert(B_compact_table<S>::check());
+  const static B_compact_table<S> NOFLASH lookup_B_compact_table{};
+  return lookup_B_compact_table.get(blT, h);
+}
+
 template <uint32_t S> uint32_t constexpr inline calc_kb(const uint32_t b_l) {
   if (b_l == 0)
     return 0;
@@ -106,4 +166,47 @@ template <uint32_t S> inline uint32_t lookup_kb(const uint32_t b_l) {
   const static kb_table<S> NOFLASH lookup_kb_table{};
   return lookup_kb_table.data[b_l];
 }
+
+// Within nest level v = bit_width(b_l), at position p = b_l - 2^(v - 1),
+//   kb = ((2p + 1) << (s - v)) + v - popcount(p),
+// so only the residual v - popcount(p) needs storing, at four bits per entry.
+template <uint32_t S> struct kb_compact_table {
+  static_assert(std::bit_width(S) <= 16, "residuals must fit in four bits");
+
+  constexpr kb_compact_table() : residuals() {
+    for (uint32_t b_l = 1; b_l < S / 2; ++b_l) {
+      const uint32_t v = std::bit_width(b_l);
+      const uint32_t p = b_l - (1 << (v - 1));
+      const uint32_t residual = v - std::popcount(p);
+      residuals[b_l / 2] |= residual << (b_l % 2 * 4);
+    }
+  }
+  constexpr uint32_t get(const uint32_t b_l) const {
+    if (b_l == 0) [[unlikely]]
+      return 0;
+
+    constexpr uint32_t s = std::bit_width(S) - 1;
+    const uint32_t v = bitwidth_uint16(b_l); // Nest level
+    const uint32_t p = b_l - (1 << (v - 1)); // Position within nest level
+    const uint32_t residual = (residuals[b_l / 2] >> (b_l % 2 * 4)) & 0xF;
+    return ((2 * p + 1) << (s - v)) + residual;
+  }
+
+  // equal to calc_kb for every b_l < S / 2
+  static constexpr bool check() {
+    const kb_compact_table table{};
+    for (uint32_t b_l = 0; b_l < S / 2; ++b_l)
+      if (table.get(b_l) != calc_kb<S>(b_l))
+        return false;
+    return true;
+  }
+
+  uint8_t residuals[S / 4];
+};
+
+template <uint32_t S> inline uint32_t lookup_kb_compact(const uint32_t b_l) {
+  static_assert(kb_compact_table<S>::check());
+  const static kb_compact_table<S> NOFLASH lookup_kb_compact_table{};
+  return lookup_kb_compact_table.get(b_l);
+}
 #endif // #ifndef ALGO_DSTREAM_HELPERS_HPP_INCLUDE
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef ALGO_DSTREAM_HYBRID_ALGO_HPP_INCLUDE
+#define ALGO_DSTREAM_HYBRID_ALGO_HPP_INCLUDE
+
+#include <cstdint>
+#include <string_view>
+
+#include "../../downstream/include/downstream/dstream/dstream.hpp"
+
+#include "./dstream_tilted_algo.hpp"
+
+// Steady retention over even T in sites [S/2, S), tilted retention over odd
+// T in sites [0, S/2), each partition seeing T >> 1 as its own time. Tilted
+// never discards and steady discards with site S/2, which the partition
+// offset carries to S, so the site needs no routing beyond that offset.
+//
+// Picking the partition kernel is one branch per item, on T & 1. It
+// alternates with period two, which branch predictors learn, so each item
+// costs about the mean of the two kernels. Selecting arithmetically instead
+// means running both kernels on every item, which costs their sum.
+template <uint32_t S>
+uint32_t _dstream_hybrid_assign_storage_site_impl(const uint32_t T) {
+  constexpr uint32_t half = S / 2;
+  using steady_algo = downstream::dstream::steady_algo_<uint32_t>;
+
+  const uint32_t T_p = T >> 1; // Partition time
+  if (T & 1)
+    return _dstream_tilted_assign_storage_site_impl<half>(T_p);
+  else
+    return half + steady_algo::_assign_storage_site(half, T_p);
+}
+
+inline uint32_t _dstream_hybrid_assign_storage_site(const uint32_t S,
+                                                    const uint32_t T) {
+  if (S == 64)
+    return _dstream_hybrid_assign_storage_site_impl<64>(T);
+  else if (S == 256)
+    return _dstream_hybrid_assign_storage_site_impl<256>(T);
+  else if (S == 1024)
+    return _dstream_hybrid_assign_storage_site_impl<1024>(T);
+  else if (S == 4096)
+    return _dstream_hybrid_assign_storage_site_impl<4096>(T);
+  else
+    __builtin_unreachable();
+}
+
+struct dstream_hybrid_algo {
+  static std::string_view get_algo_name() { return "dstream_hybrid_algo"; }
+  static uint32_t _assign_storage_site(uint32_t S, uint32_t T) {
+    return _dstream_hybrid_assign_storage_site(S, T);
+  }
+};
+#endif // #ifndef ALGO_DSTREAM_HYBRID_ALGO_HPP_INCLUDE
@@ -28,21 +28,21 @@ uint32_t _dstream_tilted_assign_storage_site_impl(const uint32_t T) {
   if (h < 8) [[likely]]
     B = lookup_B<S, 8>(blT, h);
   else
-    B = calc_B<S>(blT, h);
+    B = lookup_B_compact<S>(blT, h);
 
   const uint32_t b_l = aux::modpow2(i, B);
   uint32_t k_b; // ... bunch offset
   if constexpr (S <= 256)
     k_b = lookup_kb<S>(b_l);
   else
-    k_b = calc_kb<S>(b_l);
+    k_b = lookup_kb_compact<S>(b_l);
 
   return k_b + h; // Calculate placement site...
                   // ... where h.v. h is offset within bunch
 }
 
-uint32_t _dstream_tilted_assign_storage_site(const uint32_t S,
-                                             const uint32_t T) {
+inline uint32_t _dstream_tilted_assign_storage_site(const uint32_t S,
+                                                    const uint32_t T) {
   if (S == 64)
     return _dstream_tilted_assign_storage_site_impl<64>(T);
   else if (S == 256)
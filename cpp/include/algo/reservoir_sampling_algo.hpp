@@ -0,0 +1,83 @@
+#pragma once
+#ifndef ALGO_RESERVOIR_SAMPLING_ALGO_HPP_INCLUDE
+#define ALGO_RESERVOIR_SAMPLING_ALGO_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/xorshift_generator.hpp"
+
+// uniform reservoir sampling baseline, using Li's Algorithm L to draw skip
+// counts between replacements rather than one random number per item
+struct reservoir_sampling_algo {
+  static std::string_view get_algo_name() { return "reservoir_sampling_algo"; }
+};
+
+// uniform on the open interval (0, 1)
+inline double _reservoir_sampling_uniform(xorshift_generator &gen) {
+  return (gen() + 0.5) / 4294967296.0;
+}
+
+template <typename dtype, uint32_t num_sites>
+__attribute__((hot)) uint32_t
+execute_reservoir_sampling_assign_storage_site(const uint32_t num_items) {
+  using storage_t =
+      std::conditional_t<std::is_same_v<dtype, bool>, std::bitset<num_sites>,
+                         std::array<dtype, num_sites>>;
+  std::optional<storage_t> storage; // bypass zero-initialization
+  DoNotOptimize(*storage);
+
+  xorshift_generator gen{};        // item stream, as in other executors
+  xorshift_generator sampler_gen{}; // sampling decisions
+  sampler_gen.state ^= 0x9e3779b9;
+
+  const auto draw_weight_factor = [&sampler_gen]() {
+    return std::exp(std::log(_reservoir_sampling_uniform(sampler_gen)) /
+                    num_sites);
+  };
+  // index of next item to replace into reservoir, given weight W
+  const auto draw_skip = [&sampler_gen](const double W) {
+    const double skip =
+        std::floor(std::log(_reservoir_sampling_uniform(sampler_gen)) /
+                   std::log1p(-W));
+    return static_cast<uint64_t>(std::min(skip, 0x1p40)) + 1;
+  };
+
+  // initial fill of storage
+  const uint32_t num_filled = std::min(num_items, num_sites);
+  for (uint32_t T = 0; T < num_filled; ++T)
+    (*storage)[T] = downcast_value<dtype>(gen());
+
+  double W = draw_weight_factor();
+  uint64_t next = num_sites - 1 + draw_skip(W);
+  for (uint32_t T = num_filled; T < num_items;) {
+    // items skipped over are generated, but never stored
+    const uint32_t stop = std::min<uint64_t>(next, num_items);
+    for (; T < stop; ++T)
+      gen();
+    if (T == num_items)
+      break;
+
+    const auto data = downcast_value<dtype>(gen());
+    (*storage)[sampler_gen() % num_sites] = data;
+    ++T;
+
+    W *= draw_weight_factor();
+    next += draw_skip(W);
+  }
+
+  DoNotOptimize(*storage);
+  DoNotOptimize(gen.state);
+  DoNotOptimize(sampler_gen.state);
+  return sizeof(storage_t) + sizeof(W) + sizeof(next) +
+         sizeof(sampler_gen) + sizeof(uint32_t /* T */);
+}
+#endif // #ifndef ALGO_RESERVOIR_SAMPLING_ALGO_HPP_INCLUDE
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef ALGO_RING_BUFFER_ALGO_HPP_INCLUDE
+#define ALGO_RING_BUFFER_ALGO_HPP_INCLUDE
+
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+#include "../../downstream/include/downstream/_auxlib/modpow2.hpp"
+
+// fixed ring buffer baseline, retaining the most recent S items; wraparound
+// of the write pointer is a single mask for power-of-two S
+struct ring_buffer_algo {
+  static std::string_view get_algo_name() { return "ring_buffer_algo"; }
+  static uint32_t _assign_storage_site(const uint32_t S, const uint32_t T) {
+    assert(S && !(S & (S - 1)));
+    return downstream::_auxlib::modpow2(T, S);
+  }
+};
+#endif // #ifndef ALGO_RING_BUFFER_ALGO_HPP_INCLUDE
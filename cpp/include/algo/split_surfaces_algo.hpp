@@ -0,0 +1,54 @@
+#pragma once
+#ifndef ALGO_SPLIT_SURFACES_ALGO_HPP_INCLUDE
+#define ALGO_SPLIT_SURFACES_ALGO_HPP_INCLUDE
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "../../downstream/include/downstream/dstream/dstream.hpp"
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/xorshift_generator.hpp"
+#include "./dstream_tilted_algo.hpp"
+
+// baseline for dstream_hybrid_algo, as separate steady and tilted surfaces of
+// S/2 sites each, both ingesting every item under their own T
+struct split_steady_tilted_algo {
+  static std::string_view get_algo_name() {
+    return "split_steady_tilted_algo";
+  }
+};
+
+template <typename dtype, uint32_t num_sites>
+__attribute__((hot)) uint32_t
+execute_split_steady_tilted_assign_storage_site(const uint32_t num_items) {
+  constexpr uint32_t half = num_sites / 2;
+  using steady_algo = downstream::dstream::steady_algo_<uint32_t>;
+  using storage_t =
+      std::conditional_t<std::is_same_v<dtype, bool>, std::bitset<half>,
+                         std::array<dtype, half>>;
+  std::optional<storage_t> steady_storage; // bypass zero-initialization
+  std::optional<storage_t> tilted_storage;
+  DoNotOptimize(*steady_storage);
+  DoNotOptimize(*tilted_storage);
+
+  xorshift_generator gen{};
+  for (uint32_t T = 0; T < num_items; ++T) {
+    const auto data = downcast_value<dtype>(gen());
+    const uint32_t k = steady_algo::_assign_storage_site(half, T);
+    if (k != half)
+      (*steady_storage)[k] = data;
+    (*tilted_storage)[_dstream_tilted_assign_storage_site_impl<half>(T)] = data;
+  }
+
+  DoNotOptimize(*steady_storage);
+  DoNotOptimize(*tilted_storage);
+  DoNotOptimize(gen.state);
+  return 2 * (sizeof(storage_t) + sizeof(uint32_t /* T */));
+}
+#endif // #ifndef ALGO_SPLIT_SURFACES_ALGO_HPP_INCLUDE
@@ -0,0 +1,96 @@
+#pragma once
+#ifndef ALGO_ZHAO_TILTED_FULL_SIMD_ALGO_HPP_INCLUDE
+#define ALGO_ZHAO_TILTED_FULL_SIMD_ALGO_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/segment_lengths_vector.hpp"
+#include "../aux/smallest_unsigned_t.hpp"
+#include "../aux/xorshift_generator.hpp"
+
+// same retention as zhao_tilted_full_algo, but items never move once stored:
+// storage is a singly linked list in ingest order over fixed physical slots,
+// with a link to the oldest item of each segment
+struct zhao_tilted_full_simd_algo {
+  static std::string_view get_algo_name() {
+    return "zhao_tilted_full_simd_algo";
+  }
+};
+
+template <typename dtype, uint32_t num_sites>
+__attribute__((hot)) uint32_t
+execute_zhao_tilted_full_simd_assign_storage_site(const uint32_t num_items) {
+  using segment_lengths_t = smallest_unsigned_t<num_sites>::type;
+  using slot_t = smallest_unsigned_t<num_sites>::type;
+  constexpr auto max_segments = std::min(num_sites, 64u);
+  segment_lengths_vector<segment_lengths_t, max_segments> segment_lengths{};
+
+  // one spare slot receives each incoming item before the erased one frees up
+  constexpr auto num_slots = num_sites + 1;
+  using storage_t =
+      std::conditional_t<std::is_same_v<dtype, bool>, std::bitset<num_slots>,
+                         std::array<dtype, num_slots>>;
+  std::optional<storage_t> storage; // bypass zero-initialization
+  DoNotOptimize(*storage);
+
+  std::array<slot_t, num_slots> next;
+  std::iota(std::begin(next), std::end(next), slot_t{1});
+  std::array<slot_t, max_segments + 1> head{}; // oldest slot per segment
+  slot_t tail = num_sites - 1;
+  slot_t spare = num_sites;
+
+  xorshift_generator gen{};
+  for (uint32_t T = 0; T < num_items; ++T) {
+    const auto data = downcast_value<dtype>(gen());
+
+    if (T < num_sites) {
+      (*storage)[T] = data;
+      segment_lengths.add(0, 1);
+      continue;
+    }
+
+    auto &w = segment_lengths;
+
+    // append incoming item as newest of segment 0
+    (*storage)[spare] = data;
+    next[tail] = spare;
+    tail = spare;
+    if (w.get(0) == 0)
+      head[0] = spare;
+    w.add(0, 1);
+
+    const uint32_t j = w.find_first_descent();
+    assert(j + 1 < max_segments);
+
+    // erase second-oldest item of segment j, whose oldest moves to j + 1
+    const auto oldest = head[j];
+    const auto erased = next[oldest];
+    assert(erased != tail);
+    if (w.get(j + 1) == 0)
+      head[j + 1] = oldest;
+    head[j] = next[erased];
+    next[oldest] = next[erased];
+    spare = erased;
+
+    w.add(j, -2);
+    w.add(j + 1, 1);
+  }
+
+  DoNotOptimize(*storage);
+  DoNotOptimize(next);
+  DoNotOptimize(gen.state);
+
+  return sizeof(segment_lengths) + sizeof(storage_t) + sizeof(next) +
+         sizeof(head) + sizeof(tail) + sizeof(spare);
+}
+#endif // #ifndef ALGO_ZHAO_TILTED_FULL_SIMD_ALGO_HPP_INCLUDE
@@ -2,6 +2,8 @@
 #ifndef AUX_DONOTOPTIMIZE_HPP_INCLUDE
 #define AUX_DONOTOPTIMIZE_HPP_INCLUDE
 
+#include <type_traits>
+
 template <class Tp> inline void DoNotOptimize(Tp const &value) {
   asm volatile("" : : "r,m"(value) : "memory");
 }
@@ -10,7 +12,13 @@ template <class Tp> inline void DoNotOptimize(Tp &value) {
 #if defined(__clang__)
   asm volatile("" : "+r,m"(value) : : "memory");
 #else
-  asm volatile("" : "+m,r"(value) : : "memory");
+  // gcc may pick the register alternative for large objects and write back
+  // garbage, so only offer it where a value fits, as google/benchmark does
+  if constexpr (std::is_trivially_copyable_v<Tp> &&
+                sizeof(Tp) <= sizeof(Tp *))
+    asm volatile("" : "+m,r"(value) : : "memory");
+  else
+    asm volatile("" : "+m"(value) : : "memory");
 #endif
 }
 #endif // #ifndef AUX_DONOTOPTIMIZE_HPP_INCLUDE
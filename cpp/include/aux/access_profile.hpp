@@ -0,0 +1,114 @@
+#pragma once
+#ifndef AUX_ACCESS_PROFILE_HPP_INCLUDE
+#define AUX_ACCESS_PROFILE_HPP_INCLUDE
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "./lru_cache_model.hpp"
+
+// write pattern statistics over one window of ingested items
+struct access_profile {
+  uint32_t num_writes{};
+  uint32_t num_discards{};
+
+  // stride from the previous write, bucketed by magnitude
+  uint32_t num_sequential{};  // next site over
+  uint32_t num_within_line{}; // otherwise less than a cache line
+  uint32_t num_within_page{}; // otherwise less than a page
+  uint32_t num_beyond_page{};
+
+  uint32_t num_distinct_lines{};
+  uint32_t num_distinct_pages{};
+
+  uint64_t total_reuse_distance{}; // over writes to previously touched lines
+  uint32_t num_reuses{};
+  std::vector<uint32_t> num_misses; // per modeled cache size
+
+  double get_sequential_fraction() const {
+    return num_writes ? double(num_sequential) / num_writes : 0.0;
+  }
+
+  double get_mean_reuse_distance() const {
+    return num_reuses ? double(total_reuse_distance) / num_reuses : 0.0;
+  }
+
+  double get_miss_rate(const uint32_t i) const {
+    return num_writes ? double(num_misses[i]) / num_writes : 0.0;
+  }
+};
+
+// Accumulates an access_profile from the byte offsets of surface writes.
+//
+// Recency in the cache model carries over between windows, so cold misses
+// only appear while the surface is first touched.
+class access_profiler {
+  static constexpr uint32_t line_bytes = 64;
+  static constexpr uint32_t page_bytes = 4096;
+
+  std::vector<uint32_t> cache_lines;
+  lru_cache_model cache;
+  std::vector<uint32_t> line_window; // last window touching each line, plus 1
+  std::vector<uint32_t> page_window; // last window touching each page, plus 1
+  uint32_t window{1};
+  std::optional<uint64_t> prev_offset;
+  access_profile profile;
+
+public:
+  access_profiler(const uint64_t surface_bytes,
+                  std::vector<uint32_t> cache_lines_)
+      : cache_lines(std::move(cache_lines_)),
+        line_window((surface_bytes + line_bytes - 1) / line_bytes),
+        page_window((surface_bytes + page_bytes - 1) / page_bytes) {
+    profile.num_misses.resize(cache_lines.size());
+  }
+
+  void record_write(const uint64_t offset, const uint32_t site_bytes) {
+    ++profile.num_writes;
+
+    if (prev_offset) {
+      const uint64_t prev = *prev_offset;
+      const uint64_t stride = offset > prev ? offset - prev : prev - offset;
+      if (offset == prev + site_bytes)
+        ++profile.num_sequential;
+      else if (stride < line_bytes)
+        ++profile.num_within_line;
+      else if (stride < page_bytes)
+        ++profile.num_within_page;
+      else
+        ++profile.num_beyond_page;
+    }
+    prev_offset = offset;
+
+    const uint32_t line = offset / line_bytes;
+    const uint32_t page = offset / page_bytes;
+    profile.num_distinct_lines += std::exchange(line_window[line], window) !=
+                                  window;
+    profile.num_distinct_pages += std::exchange(page_window[page], window) !=
+                                  window;
+
+    const uint32_t distance = cache.access(line);
+    if (distance != lru_cache_model::cold) {
+      profile.total_reuse_distance += distance;
+      ++profile.num_reuses;
+    }
+    for (uint32_t i = 0; i < cache_lines.size(); ++i)
+      profile.num_misses[i] += distance >= cache_lines[i];
+  }
+
+  void record_discard() { ++profile.num_discards; }
+
+  access_profile finish_window() {
+    ++window;
+    access_profile result = std::exchange(profile, access_profile{});
+    profile.num_misses.resize(cache_lines.size());
+    return result;
+  }
+
+  const std::vector<uint32_t> &get_cache_lines() const { return cache_lines; }
+
+  static uint32_t get_line_bytes() { return line_bytes; }
+};
+#endif // #ifndef AUX_ACCESS_PROFILE_HPP_INCLUDE
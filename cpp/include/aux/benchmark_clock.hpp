@@ -0,0 +1,123 @@
+#pragma once
+#ifndef AUX_BENCHMARK_CLOCK_HPP_INCLUDE
+#define AUX_BENCHMARK_CLOCK_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCHMARK_CLOCK_HAS_TSC 1
+#endif
+
+// Tick source for benchmark timing, selected by environment variable
+// BENCHMARK_CLOCK as "chrono" (default, high_resolution_clock),
+// "monotonic_raw", or "tsc", falling back to chrono where unavailable.
+// Overhead of a pair of reads is calibrated once and subtracted from each
+// timed interval.
+class benchmark_clock {
+  enum class source { chrono, monotonic_raw, tsc };
+
+  source src;
+  double seconds_per_tick = 1e-9;
+  uint64_t overhead_ticks = 0;
+
+  static source select_source() {
+    const std::string_view name = std::getenv("BENCHMARK_CLOCK") ?: "";
+#ifdef CLOCK_MONOTONIC_RAW
+    if (name == "monotonic_raw")
+      return source::monotonic_raw;
+#endif
+#ifdef BENCHMARK_CLOCK_HAS_TSC
+    if (name == "tsc")
+      return source::tsc;
+#endif
+    return source::chrono;
+  }
+
+  // ticks per second of the TSC, against a 10ms spin of steady_clock
+  double calibrate_seconds_per_tick() const {
+    using std::chrono::steady_clock;
+    const auto start = steady_clock::now();
+    const uint64_t start_ticks = now();
+    while (steady_clock::now() - start < std::chrono::milliseconds{10})
+      ;
+    const uint64_t ticks = now() - start_ticks;
+    const std::chrono::duration<double> elapsed = steady_clock::now() - start;
+    return elapsed.count() / ticks;
+  }
+
+  uint64_t calibrate_overhead_ticks() const {
+    uint64_t res = std::numeric_limits<uint64_t>::max();
+    for (uint32_t i = 0; i < 1000; ++i) {
+      const uint64_t t1 = now();
+      const uint64_t t2 = now();
+      res = std::min(res, t2 - t1);
+    }
+    return res;
+  }
+
+  benchmark_clock() : src(select_source()) {
+    if (src == source::tsc)
+      seconds_per_tick = calibrate_seconds_per_tick();
+    overhead_ticks = calibrate_overhead_ticks();
+  }
+
+public:
+  static const benchmark_clock &get() {
+    static const benchmark_clock clock;
+    return clock;
+  }
+
+  std::string_view get_name() const {
+    switch (src) {
+    case source::monotonic_raw:
+      return "monotonic_raw";
+    case source::tsc:
+      return "tsc";
+    default:
+      return "chrono";
+    }
+  }
+
+  __attribute__((always_inline)) uint64_t now() const {
+    switch (src) {
+#ifdef CLOCK_MONOTONIC_RAW
+    case source::monotonic_raw: {
+      timespec ts;
+      clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+      return uint64_t(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+    }
+#endif
+#ifdef BENCHMARK_CLOCK_HAS_TSC
+    case source::tsc: {
+      _mm_lfence(); // keep timed work from reordering across the read
+      const uint64_t res = __rdtsc();
+      _mm_lfence();
+      return res;
+    }
+#endif
+    default: {
+      using std::chrono::high_resolution_clock;
+      using std::chrono::nanoseconds;
+      const auto since_epoch = high_resolution_clock::now().time_since_epoch();
+      return std::chrono::duration_cast<nanoseconds>(since_epoch).count();
+    }
+    }
+  }
+
+  // seconds between reads t1 and t2, net of read overhead
+  double elapsed_s(const uint64_t t1, const uint64_t t2) const {
+    const uint64_t ticks = t2 - t1;
+    return (ticks > overhead_ticks ? ticks - overhead_ticks : 0) *
+           seconds_per_tick;
+  }
+
+  double get_overhead_s() const { return overhead_ticks * seconds_per_tick; }
+};
+#endif // #ifndef AUX_BENCHMARK_CLOCK_HPP_INCLUDE
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef AUX_COMBINING_BITSET_HPP_INCLUDE
+#define AUX_COMBINING_BITSET_HPP_INCLUDE
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// dtype tag selecting write-combining bit storage
+struct combined_bit {
+  static bool from_value(const uint32_t value) { return value & 1; }
+
+  static std::string_view get_value_name() { return "combined bit"; }
+};
+
+// Bit storage that holds writes to one 64-bit word in a pending batch, then
+// applies them with a single read-modify-write once a write to another word,
+// or flush, comes along. Clustered sites, e.g., several hanoi values landing
+// in one bunch, so cost one word store per run rather than one per bit.
+// Where construction is bypassed, as for other executor storage, call
+// clear_batch before the first store; call flush before reading words back.
+template <uint32_t num_sites> class combining_bitset {
+  static constexpr uint32_t num_words = (num_sites + 63) / 64;
+
+  std::array<uint64_t, num_words> words;
+  uint32_t pending_word{};
+  uint64_t pending_mask{}; // bits written since the last flush...
+  uint64_t pending_bits{}; // ... and their values
+
+public:
+  class reference {
+    combining_bitset &self;
+    const uint32_t k;
+
+  public:
+    reference(combining_bitset &self, const uint32_t k) : self(self), k(k) {}
+
+    reference &operator=(const bool value) {
+      self.store(k, value);
+      return *this;
+    }
+
+    operator bool() const { return self.test(k); }
+  };
+
+  reference operator[](const uint32_t k) { return {*this, k}; }
+
+  void store(const uint32_t k, const bool value) {
+    const uint32_t w = k / 64;
+    if (w != pending_word) {
+      flush();
+      pending_word = w;
+    }
+    const uint64_t bit = uint64_t{1} << (k % 64);
+    pending_mask |= bit;
+    pending_bits = (pending_bits & ~bit) | (value ? bit : 0);
+  }
+
+  void clear_batch() {
+    pending_word = 0;
+    pending_mask = 0;
+    pending_bits = 0;
+  }
+
+  void flush() {
+    auto &word = words[pending_word];
+    word = (word & ~pending_mask) | pending_bits;
+    clear_batch();
+  }
+
+  bool test(const uint32_t k) const {
+    const uint32_t w = k / 64;
+    const uint64_t bit = uint64_t{1} << (k % 64);
+    if (w == pending_word && (pending_mask & bit))
+      return pending_bits & bit;
+    return words[w] & bit;
+  }
+};
+#endif // #ifndef AUX_COMBINING_BITSET_HPP_INCLUDE
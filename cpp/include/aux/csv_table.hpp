@@ -0,0 +1,57 @@
+#pragma once
+#ifndef AUX_CSV_TABLE_HPP_INCLUDE
+#define AUX_CSV_TABLE_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// minimal reader for the unquoted CSVs emitted by the benchmarks
+struct csv_table {
+  std::vector<std::string> header;
+  std::vector<std::vector<std::string>> rows;
+
+  std::optional<size_t> find_column(const std::string_view name) const {
+    const auto it = std::ranges::find(header, name);
+    if (it == std::end(header))
+      return std::nullopt;
+    return std::distance(std::begin(header), it);
+  }
+};
+
+std::vector<std::string> split_csv_line(const std::string_view line) {
+  std::vector<std::string> fields;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = line.find(',', begin);
+    fields.emplace_back(line.substr(begin, end - begin));
+    if (end == std::string_view::npos)
+      break;
+    begin = end + 1;
+  }
+  return fields;
+}
+
+csv_table read_csv_table(std::istream &is) {
+  csv_table table;
+  std::string line;
+  while (std::getline(is, line)) {
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+    if (line.empty())
+      continue;
+    else if (table.header.empty())
+      table.header = split_csv_line(line);
+    else if (line.starts_with(table.header.front() + ","))
+      continue; // skip repeated headers from concatenated runs
+    else
+      table.rows.push_back(split_csv_line(line));
+  }
+  return table;
+}
+#endif // #ifndef AUX_CSV_TABLE_HPP_INCLUDE
@@ -5,9 +5,11 @@
 #include <cstdint>
 #include <type_traits>
 
-template <typename dtype> dtype downcast_value(const uint32_t value) {
+template <typename dtype> auto downcast_value(const uint32_t value) {
   if constexpr (std::is_same_v<dtype, bool>) {
     return static_cast<bool>(value & 1);
+  } else if constexpr (requires { dtype::from_value(value); }) {
+    return dtype::from_value(value); // record types
   } else
     return static_cast<dtype>(value);
 }
@@ -0,0 +1,32 @@
+#pragma once
+#ifndef AUX_FUNCTION_OUTPUT_ITERATOR_HPP_INCLUDE
+#define AUX_FUNCTION_OUTPUT_ITERATOR_HPP_INCLUDE
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// output iterator that forwards each assigned value to a callable
+template <typename F> class function_output_iterator {
+public:
+  using iterator_category = std::output_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = void;
+  using pointer = void;
+  using reference = void;
+
+  explicit function_output_iterator(F f) : f(std::move(f)) {}
+
+  function_output_iterator &operator*() { return *this; }
+  function_output_iterator &operator++() { return *this; }
+  function_output_iterator &operator++(int) { return *this; }
+
+  template <typename T> function_output_iterator &operator=(const T &value) {
+    f(value);
+    return *this;
+  }
+
+private:
+  F f;
+};
+#endif // #ifndef AUX_FUNCTION_OUTPUT_ITERATOR_HPP_INCLUDE
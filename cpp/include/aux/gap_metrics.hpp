@@ -0,0 +1,66 @@
+#pragma once
+#ifndef AUX_GAP_METRICS_HPP_INCLUDE
+#define AUX_GAP_METRICS_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+// retention quality of sorted retained ingest times, as in the qos notebooks
+struct gap_metrics {
+  uint32_t max_gap_size;     // steady cost, items lost between retained times
+  double gap_size_cost;      // tilted cost, worst gap relative to its depth
+  double gap_size_cost_mean; // tilted cost, averaged over ranks
+};
+
+// 1 + 1/2 + ... + 1/n, asymptotically for large n
+inline double harmonic_number(const uint64_t n) {
+  if (n < 64) {
+    double res{};
+    for (uint64_t i = 1; i <= n; ++i)
+      res += 1.0 / i;
+    return res;
+  }
+  const double x = n;
+  const double x2 = x * x;
+  return std::log(x) + 0.57721566490153286 + 1 / (2 * x) - 1 / (12 * x2) +
+         1 / (120 * x2 * x2);
+}
+
+// times must be sorted, and the newest ingest time is num_ingested - 1
+inline gap_metrics calc_gap_metrics(const std::span<const uint32_t> times,
+                                    const uint32_t num_ingested) {
+  gap_metrics res{};
+  if (times.empty())
+    return res;
+
+  // max gap size, fenceposted by the newest ingest time
+  for (size_t i = 0; i < times.size(); ++i) {
+    const int64_t a = times[i];
+    const int64_t b = i + 1 < times.size() ? times[i + 1] : num_ingested - 1;
+    res.max_gap_size = std::max<int64_t>(res.max_gap_size, b - a - 1);
+  }
+
+  // gap size costs over segments between consecutive retained times, and
+  // from the newest retained time to the newest ingest time, where rank r in
+  // the span has depth total - r; the mean also counts a fencepost
+  const uint64_t total = num_ingested - 1 - times.front();
+  uint64_t cumulative{};
+  double sum{};
+  for (size_t i = 0; i < times.size(); ++i) {
+    const uint64_t b = i + 1 < times.size() ? times[i + 1] : num_ingested - 1;
+    const uint64_t length = b - times[i];
+    if (length == 0) // newest ingest time retained, no trailing segment
+      continue;
+    const uint64_t depth_end = total - cumulative - length;
+    res.gap_size_cost = std::max(res.gap_size_cost,
+                                 double(length - 1) / (depth_end + 1));
+    sum += (length - 1) * (harmonic_number(total - cumulative) -
+                           harmonic_number(depth_end));
+    cumulative += length;
+  }
+  res.gap_size_cost_mean = sum / (total + 1);
+  return res;
+}
+#endif // #ifndef AUX_GAP_METRICS_HPP_INCLUDE
@@ -0,0 +1,15 @@
+#pragma once
+#ifndef AUX_GET_BUILD_PROFILE_HPP_INCLUDE
+#define AUX_GET_BUILD_PROFILE_HPP_INCLUDE
+
+#include <string_view>
+
+// set by build targets that vary codegen flags, e.g., -falign-loops variants
+#ifndef BENCHMARK_BUILD_PROFILE
+#define BENCHMARK_BUILD_PROFILE "default"
+#endif
+
+constexpr std::string_view get_build_profile() {
+  return BENCHMARK_BUILD_PROFILE;
+}
+#endif // #ifndef AUX_GET_BUILD_PROFILE_HPP_INCLUDE
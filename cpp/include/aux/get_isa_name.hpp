@@ -0,0 +1,39 @@
+#pragma once
+#ifndef AUX_GET_ISA_NAME_HPP_INCLUDE
+#define AUX_GET_ISA_NAME_HPP_INCLUDE
+
+#include <string_view>
+
+#include "multiversion.hpp"
+
+// ISA level of the compile flags, which code outside MULTIVERSION functions
+// runs at, even in multiversioned builds
+inline std::string_view get_isa_name() {
+#if defined(__AVX512F__) && defined(__AVX512BW__) &&                           \
+    defined(__AVX512CD__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+  return "x86-64-v4";
+#elif defined(__AVX2__) && defined(__BMI2__) && defined(__LZCNT__) &&          \
+    defined(__FMA__) && defined(__MOVBE__)
+  return "x86-64-v3";
+#elif defined(__x86_64__)
+  return "x86-64";
+#else
+  return "default";
+#endif
+}
+
+// ISA level of the MULTIVERSION clones that run, matching the resolver's
+// choice in multiversioned builds and the compile flags otherwise
+inline std::string_view get_multiversion_isa_name() {
+#ifdef MULTIVERSION_ENABLED
+  if (__builtin_cpu_supports("x86-64-v4"))
+    return "x86-64-v4";
+  else if (__builtin_cpu_supports("x86-64-v3"))
+    return "x86-64-v3";
+  else
+    return "x86-64";
+#else
+  return get_isa_name();
+#endif
+}
+#endif // #ifndef AUX_GET_ISA_NAME_HPP_INCLUDE
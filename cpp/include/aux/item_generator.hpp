@@ -0,0 +1,49 @@
+#pragma once
+#ifndef AUX_ITEM_GENERATOR_HPP_INCLUDE
+#define AUX_ITEM_GENERATOR_HPP_INCLUDE
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+// minimal infinite generator; std::generator is not yet available from all
+// toolchains we target (e.g., arm-none-eabi for pico)
+template <typename T> class item_generator {
+public:
+  struct promise_type {
+    T value;
+
+    item_generator get_return_object() {
+      return item_generator{handle_t::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    std::suspend_always yield_value(const T item) noexcept {
+      value = item;
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  using handle_t = std::coroutine_handle<promise_type>;
+
+  explicit item_generator(const handle_t handle) : handle(handle) {}
+  item_generator(item_generator &&other) noexcept
+      : handle(std::exchange(other.handle, {})) {}
+  item_generator(const item_generator &) = delete;
+  ~item_generator() {
+    if (handle)
+      handle.destroy();
+  }
+
+  // resume producer until its next co_yield
+  T operator()() {
+    handle.resume();
+    return handle.promise().value;
+  }
+
+private:
+  handle_t handle;
+};
+#endif // #ifndef AUX_ITEM_GENERATOR_HPP_INCLUDE
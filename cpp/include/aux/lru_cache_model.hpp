@@ -0,0 +1,34 @@
+#pragma once
+#ifndef AUX_LRU_CACHE_MODEL_HPP_INCLUDE
+#define AUX_LRU_CACHE_MODEL_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+// Fully associative LRU cache of unbounded capacity, kept as a recency stack.
+//
+// access returns the stack distance, i.e., the number of distinct lines
+// touched since the previous access to the same line. An access misses in a
+// cache of C lines exactly when its stack distance is at least C, so one pass
+// yields miss rates for every capacity.
+class lru_cache_model {
+  std::vector<uint32_t> stack; // most recently used first
+
+public:
+  static constexpr uint32_t cold = std::numeric_limits<uint32_t>::max();
+
+  uint32_t access(const uint32_t line) {
+    const auto it = std::ranges::find(stack, line);
+    if (it == std::end(stack)) {
+      stack.insert(std::begin(stack), line);
+      return cold;
+    }
+    const uint32_t distance = std::distance(std::begin(stack), it);
+    std::rotate(std::begin(stack), it, std::next(it));
+    return distance;
+  }
+};
+#endif // #ifndef AUX_LRU_CACHE_MODEL_HPP_INCLUDE
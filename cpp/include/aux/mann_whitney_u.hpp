@@ -0,0 +1,81 @@
+#pragma once
+#ifndef AUX_MANN_WHITNEY_U_HPP_INCLUDE
+#define AUX_MANN_WHITNEY_U_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// one-sided Mann-Whitney U test p-value for the alternative hypothesis that
+// values in `a` tend to be greater than values in `b`
+//
+// exact null distribution is used for small tie-free samples, otherwise the
+// normal approximation with tie and continuity correction
+double mann_whitney_u_greater(const std::vector<double> &a,
+                              const std::vector<double> &b) {
+  const size_t n1 = a.size();
+  const size_t n2 = b.size();
+  if (n1 == 0 || n2 == 0)
+    return 1.0;
+
+  std::vector<std::pair<double, bool>> pooled; // (value, is from a)
+  pooled.reserve(n1 + n2);
+  for (const double x : a)
+    pooled.emplace_back(x, true);
+  for (const double x : b)
+    pooled.emplace_back(x, false);
+  std::ranges::sort(pooled);
+
+  // average ranks over runs of tied values
+  double rank_sum_a{};
+  double tie_term{};
+  for (size_t begin = 0; begin < pooled.size();) {
+    size_t end = begin;
+    while (end < pooled.size() && pooled[end].first == pooled[begin].first)
+      ++end;
+    const double avg_rank = (begin + 1 + end) / 2.0;
+    for (size_t i = begin; i < end; ++i)
+      rank_sum_a += pooled[i].second * avg_rank;
+    const double t = end - begin;
+    tie_term += t * t * t - t;
+    begin = end;
+  }
+  const double U = rank_sum_a - n1 * (n1 + 1) / 2.0;
+
+  constexpr size_t max_exact_n = 20;
+  if (tie_term == 0 && n1 <= max_exact_n && n2 <= max_exact_n) {
+    // counts[j][u]: arrangements of i a's and j b's with statistic u,
+    // rolled over i
+    const size_t max_u = n1 * n2;
+    std::vector<std::vector<double>> counts(
+        n2 + 1, std::vector<double>(max_u + 1, 0.0));
+    for (size_t j = 0; j <= n2; ++j)
+      counts[j][0] = 1.0; // i == 0
+    for (size_t i = 1; i <= n1; ++i) {
+      // i a's and 0 b's: only u == 0, already set
+      for (size_t j = 1; j <= n2; ++j)
+        for (size_t u = max_u; u != static_cast<size_t>(-1); --u)
+          counts[j][u] = (u >= j ? counts[j][u - j] : 0.0) +
+                         counts[j - 1][u]; // largest value from a or b
+    }
+    double total{};
+    double tail{};
+    for (size_t u = 0; u <= max_u; ++u) {
+      total += counts[n2][u];
+      tail += (u >= U) * counts[n2][u];
+    }
+    return tail / total;
+  }
+
+  const double n = n1 + n2;
+  const double mu = n1 * n2 / 2.0;
+  const double sigma = std::sqrt(n1 * n2 / 12.0 *
+                                 ((n + 1) - tie_term / (n * (n - 1))));
+  if (sigma == 0)
+    return 1.0;
+  const double z = (U - mu - 0.5) / sigma;
+  return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+#endif // #ifndef AUX_MANN_WHITNEY_U_HPP_INCLUDE
@@ -0,0 +1,17 @@
+#pragma once
+#ifndef AUX_MULTIVERSION_HPP_INCLUDE
+#define AUX_MULTIVERSION_HPP_INCLUDE
+
+// portable builds define BENCHMARK_MULTIVERSION to compile hot loops once per
+// x86-64 ISA level, with the best supported clone resolved at startup;
+// clang does not support target_clones on templates, so it is GCC-only
+#if defined(BENCHMARK_MULTIVERSION) && defined(__x86_64__) &&                  \
+    defined(__GNUC__) && !defined(__clang__)
+#define MULTIVERSION_ENABLED 1
+#define MULTIVERSION                                                           \
+  __attribute__((                                                              \
+      target_clones("default", "arch=x86-64-v3", "arch=x86-64-v4")))
+#else
+#define MULTIVERSION
+#endif
+#endif // #ifndef AUX_MULTIVERSION_HPP_INCLUDE
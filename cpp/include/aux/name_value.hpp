@@ -17,6 +17,8 @@ template <typename dtype> std::string_view name_value() {
     return "double word";
   } else if constexpr (std::is_same_v<dtype, uint64_t>) {
     return "quad word";
+  } else if constexpr (requires { dtype::get_value_name(); }) {
+    return dtype::get_value_name(); // record types
   } else
     static_assert(false);
 }
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef AUX_SEGMENT_LENGTHS_VECTOR_HPP_INCLUDE
+#define AUX_SEGMENT_LENGTHS_VECTOR_HPP_INCLUDE
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// n small counters held as whole vectors, alongside a copy shifted down by
+// one lane, so that finding the first descent w[j] > w[j + 1] takes one
+// compare per vector and updates never round-trip through memory
+template <typename T, uint32_t n> struct segment_lengths_vector {
+  static constexpr uint32_t vector_bytes = 32;
+  static constexpr uint32_t num_lanes = vector_bytes / sizeof(T);
+  static constexpr uint32_t num_vectors = (n + num_lanes - 1) / num_lanes;
+  typedef T vec_t __attribute__((vector_size(vector_bytes)));
+
+  vec_t cur[num_vectors]{}; // w[k]
+  vec_t nxt[num_vectors]{}; // w[k + 1], zero past the end
+
+  T get(const uint32_t k) const { return cur[k / num_lanes][k % num_lanes]; }
+
+  // w[k] += delta, with wraparound for negative deltas
+  __attribute__((always_inline)) void add(const uint32_t k, const T delta) {
+    vec_t lane_indices; // folded to a constant by optimizer
+    for (uint32_t l = 0; l < num_lanes; ++l)
+      lane_indices[l] = l;
+    for (uint32_t v = 0; v < num_vectors; ++v) {
+      const vec_t idx = lane_indices + static_cast<T>(v * num_lanes);
+      cur[v] += (vec_t)(idx == static_cast<T>(k)) & delta;
+      nxt[v] += (vec_t)(idx + 1 == static_cast<T>(k)) & delta;
+    }
+  }
+
+  // first j with w[j] > w[j + 1]; one must exist
+  __attribute__((always_inline)) uint32_t find_first_descent() const {
+    constexpr uint32_t num_words = vector_bytes / sizeof(uint64_t);
+    for (uint32_t v = 0; v < num_vectors; ++v) {
+      const auto descents = cur[v] > nxt[v]; // all-ones lanes
+      uint64_t words[num_words];
+      std::memcpy(words, &descents, sizeof(words));
+      for (uint32_t q = 0; q < num_words; ++q) {
+        if (words[q]) {
+          const uint32_t byte =
+              q * sizeof(uint64_t) + std::countr_zero(words[q]) / 8;
+          return v * num_lanes + byte / sizeof(T);
+        }
+      }
+    }
+    __builtin_unreachable();
+  }
+};
+#endif // #ifndef AUX_SEGMENT_LENGTHS_VECTOR_HPP_INCLUDE
@@ -0,0 +1,32 @@
+#pragma once
+#ifndef AUX_SITE_STORAGE_T_HPP_INCLUDE
+#define AUX_SITE_STORAGE_T_HPP_INCLUDE
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+#include "combining_bitset.hpp"
+#include "soa_array.hpp"
+
+// storage layout for num_sites values of dtype, array-of-structs by default
+template <typename dtype, uint32_t num_sites> struct site_storage {
+  using type = std::array<dtype, num_sites>;
+};
+
+template <uint32_t num_sites> struct site_storage<bool, num_sites> {
+  using type = std::bitset<num_sites>;
+};
+
+template <uint32_t num_sites> struct site_storage<combined_bit, num_sites> {
+  using type = combining_bitset<num_sites>;
+};
+
+template <typename record, uint32_t num_sites>
+struct site_storage<soa<record>, num_sites> {
+  using type = soa_array<record, num_sites>;
+};
+
+template <typename dtype, uint32_t num_sites>
+using site_storage_t = site_storage<dtype, num_sites>::type;
+#endif // #ifndef AUX_SITE_STORAGE_T_HPP_INCLUDE
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef AUX_SOA_ARRAY_HPP_INCLUDE
+#define AUX_SOA_ARRAY_HPP_INCLUDE
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "downcast_value.hpp"
+#include "name_value.hpp"
+
+// dtype tag selecting struct-of-arrays storage for record
+template <typename record> struct soa {
+  static record from_value(const uint32_t value) {
+    return downcast_value<record>(value);
+  }
+
+  static std::string_view get_value_name() {
+    static const std::string name =
+        std::format("{} soa", name_value<record>());
+    return name;
+  }
+};
+
+// records split into 8-byte lanes, each lane stored contiguously across sites
+template <typename record, uint32_t num_sites> class soa_array {
+  static_assert(std::is_trivially_copyable_v<record>);
+  static_assert(sizeof(record) % sizeof(uint64_t) == 0);
+  static constexpr uint32_t num_lanes = sizeof(record) / sizeof(uint64_t);
+
+  std::array<std::array<uint64_t, num_sites>, num_lanes> lanes;
+
+public:
+  class reference {
+    soa_array &self;
+    const uint32_t k;
+
+  public:
+    reference(soa_array &self, const uint32_t k) : self(self), k(k) {}
+
+    reference &operator=(const record &value) {
+      uint64_t words[num_lanes];
+      std::memcpy(words, &value, sizeof(record));
+      for (uint32_t l = 0; l < num_lanes; ++l)
+        self.lanes[l][k] = words[l];
+      return *this;
+    }
+
+    operator record() const {
+      uint64_t words[num_lanes];
+      for (uint32_t l = 0; l < num_lanes; ++l)
+        words[l] = self.lanes[l][k];
+      record res;
+      std::memcpy(&res, words, sizeof(record));
+      return res;
+    }
+  };
+
+  reference operator[](const uint32_t k) { return {*this, k}; }
+};
+#endif // #ifndef AUX_SOA_ARRAY_HPP_INCLUDE
@@ -0,0 +1,27 @@
+#pragma once
+#ifndef AUX_VARINT_HPP_INCLUDE
+#define AUX_VARINT_HPP_INCLUDE
+
+#include <cstdint>
+
+// unsigned LEB128: seven bits per byte, high bit set on all but the last
+template <typename OutputIt>
+OutputIt write_varint(OutputIt out, uint32_t value) {
+  while (value >= 0x80) {
+    *out++ = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<uint8_t>(value);
+  return out;
+}
+
+template <typename InputIt> uint32_t read_varint(InputIt &in) {
+  uint32_t value{};
+  for (uint32_t shift = 0;; shift += 7) {
+    const uint8_t byte = *in++;
+    value |= uint32_t{byte & 0x7fu} << shift;
+    if (!(byte & 0x80))
+      return value;
+  }
+}
+#endif // #ifndef AUX_VARINT_HPP_INCLUDE
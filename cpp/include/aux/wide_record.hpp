@@ -0,0 +1,49 @@
+#pragma once
+#ifndef AUX_WIDE_RECORD_HPP_INCLUDE
+#define AUX_WIDE_RECORD_HPP_INCLUDE
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+
+template <uint32_t num_words> struct wide_record_payload {
+  std::array<uint64_t, num_words> payload;
+  void fill_payload(const uint64_t value) { payload.fill(value); }
+};
+
+// empty base, so 16-byte records carry no payload
+template <> struct wide_record_payload<0> {
+  void fill_payload(uint64_t) {}
+};
+
+// stand-in for a production site payload, e.g., a timestamped observation
+template <uint32_t num_bytes>
+struct wide_record : wide_record_payload<(num_bytes - 16) / 8> {
+  static_assert(num_bytes >= 16 && num_bytes % sizeof(uint64_t) == 0);
+
+  uint64_t timestamp;
+  uint32_t id;
+  uint32_t checksum;
+
+  static wide_record from_value(const uint32_t value) {
+    wide_record res;
+    res.timestamp = value;
+    res.id = value * 2654435761u;
+    res.checksum = std::rotl(res.id, 7) ^ value;
+    res.fill_payload(res.timestamp);
+    return res;
+  }
+
+  static std::string_view get_value_name() {
+    static const std::string name = std::format("{}-byte record", num_bytes);
+    return name;
+  }
+};
+
+static_assert(sizeof(wide_record<16>) == 16);
+static_assert(sizeof(wide_record<32>) == 32);
+static_assert(sizeof(wide_record<64>) == 64);
+#endif // #ifndef AUX_WIDE_RECORD_HPP_INCLUDE
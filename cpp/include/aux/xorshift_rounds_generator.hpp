@@ -0,0 +1,19 @@
+#pragma once
+#ifndef AUX_XORSHIFT_ROUNDS_GENERATOR_HPP_INCLUDE
+#define AUX_XORSHIFT_ROUNDS_GENERATOR_HPP_INCLUDE
+
+#include <cstdint>
+
+#include "./xorshift_generator.hpp"
+
+// stand-in for an expensive producer: serially dependent xorshift rounds
+template <uint32_t rounds>
+struct xorshift_rounds_generator : xorshift_generator {
+  uint32_t operator()() {
+    uint32_t x{};
+    for (uint32_t r = 0; r < rounds; ++r)
+      x = xorshift_generator::operator()();
+    return x;
+  }
+};
+#endif // #ifndef AUX_XORSHIFT_ROUNDS_GENERATOR_HPP_INCLUDE
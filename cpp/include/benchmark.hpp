@@ -8,8 +8,12 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <format>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
 
@@ -18,70 +22,109 @@
 #include "./algo/control_throwaway_algo.hpp"
 #include "./algo/doubling_steady_algo.hpp"
 #include "./algo/doubling_tilted_algo.hpp"
+#include "./algo/dstream_hybrid_algo.hpp"
 #include "./algo/dstream_stretched_algo.hpp"
 #include "./algo/dstream_tilted_algo.hpp"
+#include "./algo/reservoir_sampling_algo.hpp"
+#include "./algo/ring_buffer_algo.hpp"
+#include "./algo/split_surfaces_algo.hpp"
 #include "./algo/zhao_steady_algo.hpp"
 #include "./algo/zhao_tilted_algo.hpp"
 #include "./algo/zhao_tilted_full_algo.hpp"
+#include "./algo/zhao_tilted_full_simd_algo.hpp"
+#include "./aux/benchmark_clock.hpp"
 #include "./aux/DoNotOptimize.hpp"
 #include "./aux/downcast_value.hpp"
+#include "./aux/function_output_iterator.hpp"
+#include "./aux/get_build_profile.hpp"
 #include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/multiversion.hpp"
 #include "./aux/name_value.hpp"
+#include "./aux/site_storage_t.hpp"
+#include "./aux/soa_array.hpp"
+#include "./aux/wide_record.hpp"
 #include "./aux/xorshift_generator.hpp"
 
 struct benchmark_result {
   std::string_view algo_name;
   std::string_view data_type;
+  std::string_view isa; // of the executor, which may be a MULTIVERSION clone
   uint32_t memory_bytes;
   uint32_t num_items;
   uint32_t num_sites;
   uint32_t replicate;
   double duration_s;
+  // paired control_throwaway_algo run, if any has the executor's shape
+  std::optional<double> control_duration_s;
 
   static std::string_view make_csv_header() {
-    return ("algo_name,data_type,compiler,memory_bytes,num_items,"
-            "num_sites,replicate,duration_s\n");
+    return ("algo_name,data_type,compiler,build_profile,isa,clock,"
+            "memory_bytes,num_items,num_sites,replicate,duration_s,"
+            "control_duration_s,net_ns_per_ingest\n");
   }
 
   std::string make_csv_row() const {
     constexpr std::string_view compiler_name = get_compiler_name();
-    return std::format("{},{},{},{},{},{},{},{}\n", algo_name, data_type,
-                       compiler_name, memory_bytes, num_items, num_sites,
-                       replicate, duration_s);
+    constexpr std::string_view build_profile = get_build_profile();
+    // control_duration_s and net_ns_per_ingest, empty if unpaired
+    std::string control_fields = ",";
+    if (control_duration_s)
+      control_fields =
+          std::format("{},{}", *control_duration_s,
+                      (duration_s - *control_duration_s) * 1e9 / num_items);
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, build_profile, isa,
+                       benchmark_clock::get().get_name(), memory_bytes,
+                       num_items, num_sites, replicate, duration_s,
+                       control_fields);
   }
 };
 
 namespace std {
-std::ostream &operator<<(std::ostream &os, const benchmark_result &result) {
+inline std::ostream &operator<<(std::ostream &os,
+                                const benchmark_result &result) {
   os << result.make_csv_row();
   return os;
 }
 } // namespace std
 
-template <typename dstream_algo, typename dtype, uint32_t num_sites>
-__attribute__((hot)) uint32_t
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          typename producer_t = xorshift_generator>
+__attribute__((hot)) MULTIVERSION uint32_t
 execute_dstream_assign_storage_site(const uint32_t num_items) {
 
-  using storage_t =
-      std::conditional_t<std::is_same_v<dtype, bool>, std::bitset<num_sites>,
-                         std::array<dtype, num_sites>>;
+  using storage_t = site_storage_t<dtype, num_sites>;
   std::optional<storage_t> storage; // bypass zero-initialization
+  constexpr bool is_combining = requires(storage_t &s) { s.flush(); };
+  if constexpr (is_combining)
+    storage->clear_batch(); // write-combining storage needs an empty batch
   DoNotOptimize(*storage);
-  xorshift_generator gen{};
+  producer_t gen{};
   for (uint32_t i = 0; i < num_items; ++i) {
     const auto k = dstream_algo::_assign_storage_site(num_sites, i);
     const auto data = downcast_value<dtype>(gen());
     if (k != num_sites)
       (*storage)[k] = data;
   }
+  if constexpr (is_combining)
+    storage->flush();
 
   DoNotOptimize(*storage);
   DoNotOptimize(gen.state);
   return sizeof(storage_t) + sizeof(uint32_t /* i */);
 }
 
+// specializations run plain code at the build's ISA level; only the generic
+// executor is multiversioned, and only it shares the control's shape
 template <typename dtype, uint32_t num_sites, typename algo>
 struct execute_assign_storage_site {
+  static constexpr bool is_generic = true;
+
+  static std::string_view get_isa_name() {
+    return get_multiversion_isa_name();
+  }
+
   static uint32_t operator()(const uint32_t num_items) {
     return execute_dstream_assign_storage_site<algo, dtype, num_sites>(
         num_items);
@@ -104,6 +147,24 @@ struct execute_assign_storage_site<dtype, num_sites, doubling_tilted_algo> {
   }
 };
 
+template <typename dtype, uint32_t num_sites>
+struct execute_assign_storage_site<dtype, num_sites,
+                                   reservoir_sampling_algo> {
+  static uint32_t operator()(const uint32_t num_items) {
+    return execute_reservoir_sampling_assign_storage_site<dtype, num_sites>(
+        num_items);
+  }
+};
+
+template <typename dtype, uint32_t num_sites>
+struct execute_assign_storage_site<dtype, num_sites,
+                                   split_steady_tilted_algo> {
+  static uint32_t operator()(const uint32_t num_items) {
+    return execute_split_steady_tilted_assign_storage_site<dtype, num_sites>(
+        num_items);
+  }
+};
+
 template <typename dtype, uint32_t num_sites>
 struct execute_assign_storage_site<dtype, num_sites, zhao_steady_algo> {
   static uint32_t operator()(const uint32_t num_items) {
@@ -126,25 +187,60 @@ struct execute_assign_storage_site<dtype, num_sites, zhao_tilted_full_algo> {
   }
 };
 
+template <typename dtype, uint32_t num_sites>
+struct execute_assign_storage_site<dtype, num_sites,
+                                   zhao_tilted_full_simd_algo> {
+  static uint32_t operator()(const uint32_t num_items) {
+    return execute_zhao_tilted_full_simd_assign_storage_site<dtype, num_sites>(
+        num_items);
+  }
+};
+
 template <typename algo, typename dtype, uint32_t num_sites>
 benchmark_result time_assign_storage_site(const uint32_t replicate,
                                           const uint32_t num_items) {
-  using std::chrono::duration_cast;
-  using std::chrono::high_resolution_clock;
+  const auto &clock = benchmark_clock::get();
 
-  const auto t1 = high_resolution_clock::now();
   using executor = execute_assign_storage_site<dtype, num_sites, algo>;
+  using control_executor =
+      execute_assign_storage_site<dtype, num_sites, control_throwaway_algo>;
+
+  // same-shape control, so RNG and loop overhead can be subtracted out; it
+  // runs first on odd replicates, so neither run always inherits the other's
+  // warm caches and clock frequency
+  constexpr bool is_paired = requires { requires executor::is_generic; } &&
+                             !std::is_same_v<algo, control_throwaway_algo>;
+  std::optional<double> control_duration_s;
+  const auto time_control = [&] {
+    const auto t1 = clock.now();
+    control_executor::operator()(num_items);
+    const auto t2 = clock.now();
+    control_duration_s = clock.elapsed_s(t1, t2);
+  };
+  const bool is_control_first = is_paired && replicate % 2;
+  if (is_control_first)
+    time_control();
+
+  const auto t1 = clock.now();
   const auto memory_bytes = executor::operator()(num_items);
-  const auto t2 = high_resolution_clock::now();
+  const auto t2 = clock.now();
+
+  if (is_paired && !is_control_first)
+    time_control();
+
+  std::string_view isa = get_isa_name();
+  if constexpr (requires { executor::get_isa_name(); })
+    isa = executor::get_isa_name();
 
   return {.algo_name = algo::get_algo_name(),
           .data_type = name_value<dtype>(),
+          .isa = isa,
           .memory_bytes = memory_bytes,
           .num_items = num_items,
           .num_sites = num_sites,
           .replicate = replicate,
-          .duration_s =
-              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+          .duration_s = clock.elapsed_s(t1, t2),
+          .control_duration_s = control_duration_s};
 }
 
 template <typename algo, typename dtype, uint32_t num_sites, typename OutputIt>
@@ -183,31 +279,143 @@ void benchmark_assign_storage_site(OutputIt out) {
   benchmark_assign_storage_site_<algo, bool, 1024>(out);
   benchmark_assign_storage_site_<algo, bool, 256>(out);
   benchmark_assign_storage_site_<algo, bool, 64>(out);
+
+  // write-combining bits, flushed by the generic executor
+  if constexpr (requires { algo::_assign_storage_site(0u, 0u); }) {
+    benchmark_assign_storage_site_<algo, combined_bit, 4096>(out);
+    benchmark_assign_storage_site_<algo, combined_bit, 1024>(out);
+    benchmark_assign_storage_site_<algo, combined_bit, 256>(out);
+    benchmark_assign_storage_site_<algo, combined_bit, 64>(out);
+  }
+
+  // record payloads exceed embedded RAM; only the generic executor supports
+  // struct-of-arrays storage
+#if !__has_include("pico/platform/sections.h")
+  if constexpr (requires { algo::_assign_storage_site(0u, 0u); }) {
+    benchmark_assign_storage_site_<algo, wide_record<64>, 4096>(out);
+    benchmark_assign_storage_site_<algo, wide_record<64>, 1024>(out);
+    benchmark_assign_storage_site_<algo, wide_record<64>, 256>(out);
+    benchmark_assign_storage_site_<algo, wide_record<64>, 64>(out);
+
+    benchmark_assign_storage_site_<algo, wide_record<32>, 4096>(out);
+    benchmark_assign_storage_site_<algo, wide_record<32>, 1024>(out);
+    benchmark_assign_storage_site_<algo, wide_record<32>, 256>(out);
+    benchmark_assign_storage_site_<algo, wide_record<32>, 64>(out);
+
+    benchmark_assign_storage_site_<algo, wide_record<16>, 4096>(out);
+    benchmark_assign_storage_site_<algo, wide_record<16>, 1024>(out);
+    benchmark_assign_storage_site_<algo, wide_record<16>, 256>(out);
+    benchmark_assign_storage_site_<algo, wide_record<16>, 64>(out);
+
+    benchmark_assign_storage_site_<algo, soa<wide_record<64>>, 4096>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<64>>, 1024>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<64>>, 256>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<64>>, 64>(out);
+
+    benchmark_assign_storage_site_<algo, soa<wide_record<32>>, 4096>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<32>>, 1024>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<32>>, 256>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<32>>, 64>(out);
+
+    benchmark_assign_storage_site_<algo, soa<wide_record<16>>, 4096>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<16>>, 1024>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<16>>, 256>(out);
+    benchmark_assign_storage_site_<algo, soa<wide_record<16>>, 64>(out);
+  }
+#endif
 }
 
-int run_benchmark() {
-  using u32 = std::uint32_t;
-  using dstream_circular_algo_ = downstream::dstream::circular_algo_<u32>;
-  using dstream_compressing_algo_ = downstream::dstream::compressing_algo_<u32>;
-  using dstream_steady_algo_ = downstream::dstream::steady_algo_<u32>;
-  using dstream_stretched_algo_ = downstream::dstream::stretched_algo_<u32>;
-  using dstream_tilted_algo_ = downstream::dstream::tilted_algo_<u32>;
+using dstream_circular_algo_ = downstream::dstream::circular_algo_<uint32_t>;
+using dstream_compressing_algo_ =
+    downstream::dstream::compressing_algo_<uint32_t>;
+using dstream_steady_algo_ = downstream::dstream::steady_algo_<uint32_t>;
+using dstream_stretched_algo_ = downstream::dstream::stretched_algo_<uint32_t>;
+using dstream_tilted_algo_ = downstream::dstream::tilted_algo_<uint32_t>;
+
+// type-erased sink, so per-algorithm sweeps can be explicitly instantiated
+using benchmark_output_t =
+    function_output_iterator<std::function<void(const benchmark_result &)>>;
+
+// instantiated in per-algorithm translation units under native/algo/
+#ifdef BENCHMARK_EXTERN_ALGOS
+extern template void
+benchmark_assign_storage_site<control_throwaway_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_stretched_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_tilted_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_hybrid_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<split_steady_tilted_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_circular_algo_>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_compressing_algo_>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_steady_algo_>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_stretched_algo_>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<dstream_tilted_algo_>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<doubling_steady_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<doubling_tilted_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<reservoir_sampling_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<ring_buffer_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<zhao_steady_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<zhao_tilted_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<zhao_tilted_full_algo>(benchmark_output_t);
+extern template void
+benchmark_assign_storage_site<zhao_tilted_full_simd_algo>(benchmark_output_t);
+#endif // #ifdef BENCHMARK_EXTERN_ALGOS
+
+template <typename OutputIt>
+benchmark_output_t make_benchmark_output(OutputIt &out) {
+  return benchmark_output_t{
+      [&out](const benchmark_result &result) { *out++ = result; }};
+}
+
+template <typename OutputIt> void benchmark_algos(OutputIt out) {
+  const auto sink = make_benchmark_output(out);
+  benchmark_assign_storage_site<control_throwaway_algo>(sink);
+  benchmark_assign_storage_site<dstream_stretched_algo>(sink);
+  benchmark_assign_storage_site<dstream_tilted_algo>(sink);
+  benchmark_assign_storage_site<dstream_hybrid_algo>(sink);
+  benchmark_assign_storage_site<split_steady_tilted_algo>(sink);
+  benchmark_assign_storage_site<dstream_circular_algo_>(sink);
+  benchmark_assign_storage_site<dstream_compressing_algo_>(sink);
+  benchmark_assign_storage_site<dstream_steady_algo_>(sink);
+  benchmark_assign_storage_site<dstream_stretched_algo_>(sink);
+  benchmark_assign_storage_site<dstream_tilted_algo_>(sink);
+  benchmark_assign_storage_site<doubling_steady_algo>(sink);
+  benchmark_assign_storage_site<doubling_tilted_algo>(sink);
+  benchmark_assign_storage_site<reservoir_sampling_algo>(sink);
+  benchmark_assign_storage_site<ring_buffer_algo>(sink);
+  benchmark_assign_storage_site<zhao_steady_algo>(sink);
+  benchmark_assign_storage_site<zhao_tilted_algo>(sink);
+  benchmark_assign_storage_site<zhao_tilted_full_algo>(sink);
+  benchmark_assign_storage_site<zhao_tilted_full_simd_algo>(sink);
+}
+
+inline int run_benchmark() {
+  std::cout << benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<benchmark_result>(std::cout);
+  benchmark_algos(out);
+  return 0;
+}
 
+// entry point for single-algorithm binaries
+template <typename algo> int run_benchmark_algo() {
   std::cout << benchmark_result::make_csv_header();
   auto out = std::ostream_iterator<benchmark_result>(std::cout);
-  benchmark_assign_storage_site<control_throwaway_algo>(out);
-  benchmark_assign_storage_site<dstream_stretched_algo>(out);
-  benchmark_assign_storage_site<dstream_tilted_algo>(out);
-  benchmark_assign_storage_site<dstream_circular_algo_>(out);
-  benchmark_assign_storage_site<dstream_compressing_algo_>(out);
-  benchmark_assign_storage_site<dstream_steady_algo_>(out);
-  benchmark_assign_storage_site<dstream_stretched_algo_>(out);
-  benchmark_assign_storage_site<dstream_tilted_algo_>(out);
-  benchmark_assign_storage_site<doubling_steady_algo>(out);
-  benchmark_assign_storage_site<doubling_tilted_algo>(out);
-  benchmark_assign_storage_site<zhao_steady_algo>(out);
-  benchmark_assign_storage_site<zhao_tilted_algo>(out);
-  benchmark_assign_storage_site<zhao_tilted_full_algo>(out);
+  benchmark_assign_storage_site<algo>(make_benchmark_output(out));
   return 0;
 }
 #endif // #ifndef BENCHMARK_HPP_INCLUDE
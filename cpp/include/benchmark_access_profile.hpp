@@ -0,0 +1,117 @@
+#pragma once
+#ifndef BENCHMARK_ACCESS_PROFILE_HPP_INCLUDE
+#define BENCHMARK_ACCESS_PROFILE_HPP_INCLUDE
+
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./algo/ring_buffer_algo.hpp"
+#include "./aux/access_profile.hpp"
+#include "./aux/function_output_iterator.hpp"
+#include "./aux/name_value.hpp"
+#include "./benchmark.hpp"
+#include "./ingest/profile_ingest.hpp"
+
+struct access_profile_options {
+  uint32_t num_items = 1'000'000;
+  uint32_t window_size = 65'536;
+  std::vector<uint32_t> cache_bytes; // defaults to 512 B, 4 KiB, and 32 KiB
+};
+
+std::string make_access_profile_csv_header(
+    const std::vector<uint32_t> &cache_bytes) {
+  std::string header = "algo_name,data_type,num_sites,num_items,window_size,"
+                       "window,num_writes,num_discards,num_sequential,"
+                       "num_within_line,num_within_page,num_beyond_page,"
+                       "sequential_fraction,distinct_lines,distinct_pages,"
+                       "mean_reuse_distance";
+  for (const auto bytes : cache_bytes)
+    header += std::format(",miss_rate_{}B", bytes);
+  return header + '\n';
+}
+
+template <typename algo, typename dtype, uint32_t num_sites>
+void profile_assign_storage_site(const access_profile_options &options) {
+  std::vector<uint32_t> cache_lines;
+  for (const auto bytes : options.cache_bytes)
+    cache_lines.push_back(bytes / access_profiler::get_line_bytes());
+
+  uint32_t window{};
+  auto out = function_output_iterator{[&](const access_profile &p) {
+    std::string row = std::format(
+        "{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}",
+        algo::get_algo_name(), name_value<dtype>(), num_sites,
+        options.num_items, options.window_size, window++, p.num_writes,
+        p.num_discards, p.num_sequential, p.num_within_line,
+        p.num_within_page, p.num_beyond_page, p.get_sequential_fraction(),
+        p.num_distinct_lines, p.num_distinct_pages,
+        p.get_mean_reuse_distance());
+    for (uint32_t i = 0; i < cache_lines.size(); ++i)
+      row += std::format(",{}", p.get_miss_rate(i));
+    std::cout << row << '\n';
+  }};
+  execute_profile_assign_storage_site<algo, dtype, num_sites>(
+      options.num_items, options.window_size, cache_lines, out);
+}
+
+template <typename algo, typename dtype>
+void profile_assign_storage_site_(const access_profile_options &options) {
+  profile_assign_storage_site<algo, dtype, 4096>(options);
+  profile_assign_storage_site<algo, dtype, 1024>(options);
+  profile_assign_storage_site<algo, dtype, 256>(options);
+  profile_assign_storage_site<algo, dtype, 64>(options);
+}
+
+template <typename algo>
+void profile_assign_storage_site(const access_profile_options &options) {
+  profile_assign_storage_site_<algo, uint32_t>(options);
+  profile_assign_storage_site_<algo, uint8_t>(options);
+}
+
+// only algorithms exposing _assign_storage_site have a site schedule to replay
+int run_access_profile(const access_profile_options &options) {
+  std::cout << make_access_profile_csv_header(options.cache_bytes);
+  profile_assign_storage_site<ring_buffer_algo>(options);
+  profile_assign_storage_site<dstream_stretched_algo>(options);
+  profile_assign_storage_site<dstream_tilted_algo>(options);
+  profile_assign_storage_site<dstream_circular_algo_>(options);
+  profile_assign_storage_site<dstream_compressing_algo_>(options);
+  profile_assign_storage_site<dstream_steady_algo_>(options);
+  return 0;
+}
+
+// usage:
+//   access_profile [--num-items N] [--window N] [--cache-bytes B]...
+int run_access_profile_cli(const int argc, char *argv[]) {
+  access_profile_options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--num-items" && has_value)
+      options.num_items = std::stoul(argv[++i]);
+    else if (arg == "--window" && has_value)
+      options.window_size = std::stoul(argv[++i]);
+    else if (arg == "--cache-bytes" && has_value)
+      options.cache_bytes.push_back(std::stoul(argv[++i]));
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--num-items N] [--window N] [--cache-bytes B]...\n";
+      return 2;
+    }
+  }
+  if (options.window_size == 0) {
+    std::cerr << "window must be positive\n";
+    return 2;
+  }
+  if (options.cache_bytes.empty())
+    options.cache_bytes = {512, 4096, 32768};
+
+  return run_access_profile(options);
+}
+#endif // #ifndef BENCHMARK_ACCESS_PROFILE_HPP_INCLUDE
@@ -0,0 +1,234 @@
+#pragma once
+#ifndef BENCHMARK_BITOPS_HPP_INCLUDE
+#define BENCHMARK_BITOPS_HPP_INCLUDE
+
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../downstream/include/downstream/_auxlib/modpow2.hpp"
+
+#include "./algo/doubling_steady_algo.hpp"
+#include "./aux/benchmark_clock.hpp"
+#include "./aux/ctz_naive.hpp"
+#include "./aux/divpow2.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/log2_naive.hpp"
+#include "./aux/smallbitops.hpp"
+#include "./aux/xorshift_generator.hpp"
+
+struct bitops_benchmark_result {
+  std::string_view primitive;
+  std::string_view implementation;
+  std::string_view distribution;
+  std::string_view mode;
+  uint32_t num_ops;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("primitive,implementation,distribution,mode,compiler,isa,clock,"
+            "num_ops,replicate,duration_s,ns_per_op\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{}\n", primitive,
+                       implementation, distribution, mode, compiler_name,
+                       get_isa_name(), benchmark_clock::get().get_name(),
+                       num_ops, replicate, duration_s,
+                       duration_s * 1e9 / num_ops);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const bitops_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+// operand pairs, small enough to stay L1-resident across passes
+struct bitops_inputs {
+  static constexpr uint32_t size = 2048;
+  std::string_view distribution;
+  std::vector<uint32_t> a;
+  std::vector<uint32_t> b;
+};
+
+// Latency: each operand depends on the previous result through a mask that
+// is zero at runtime, but opaque to the compiler, so calls cannot overlap.
+template <typename F>
+__attribute__((noinline)) uint32_t
+run_bitop_latency(F f, const bitops_inputs &inputs, const uint32_t num_passes,
+                  const uint32_t zero) {
+  uint32_t v{};
+  for (uint32_t pass = 0; pass < num_passes; ++pass)
+    for (uint32_t i = 0; i < bitops_inputs::size; ++i)
+      v = f(inputs.a[i] ^ (v & zero), inputs.b[i]);
+  return v;
+}
+
+// Throughput: calls are independent, so they may pipeline or vectorize.
+template <typename F>
+__attribute__((noinline)) uint32_t
+run_bitop_throughput(F f, const bitops_inputs &inputs,
+                     const uint32_t num_passes) {
+  uint32_t acc{};
+  for (uint32_t pass = 0; pass < num_passes; ++pass) {
+    for (uint32_t i = 0; i < bitops_inputs::size; ++i)
+      acc += f(inputs.a[i], inputs.b[i]);
+    DoNotOptimize(acc); // clobbers inputs, so passes are not folded together
+  }
+  return acc;
+}
+
+template <typename F, typename OutputIt>
+void benchmark_bitop_(const std::string_view primitive,
+                      const std::string_view implementation, F f,
+                      const bitops_inputs &inputs, OutputIt out) {
+  const uint32_t num_replicates = 10;
+  const uint32_t num_passes = 512;
+  const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+  const uint32_t zero = std::strlen(env_var);
+  const auto &clock = benchmark_clock::get();
+
+  for (uint32_t replicate = 0; replicate < num_replicates; ++replicate) {
+    for (const std::string_view mode : {"latency", "throughput"}) {
+      const auto t1 = clock.now();
+      uint32_t result = mode == "latency"
+                            ? run_bitop_latency(f, inputs, num_passes, zero)
+                            : run_bitop_throughput(f, inputs, num_passes);
+      const auto t2 = clock.now();
+      DoNotOptimize(result);
+
+      *out++ = bitops_benchmark_result{
+          .primitive = primitive,
+          .implementation = implementation,
+          .distribution = inputs.distribution,
+          .mode = mode,
+          .num_ops = num_passes * bitops_inputs::size,
+          .replicate = replicate,
+          .duration_s = clock.elapsed_s(t1, t2)};
+    }
+  }
+}
+
+// times the aux primitive against its <bit> equivalent, on both inputs
+template <typename AuxF, typename StdF, typename OutputIt>
+void benchmark_bitop(const std::string_view primitive, AuxF aux_f, StdF std_f,
+                     const bitops_inputs &uniform,
+                     const bitops_inputs &realistic, OutputIt out) {
+  for (const auto *inputs : {&uniform, &realistic}) {
+    benchmark_bitop_(primitive, "aux", aux_f, *inputs, out);
+    benchmark_bitop_(primitive, "std", std_f, *inputs, out);
+  }
+}
+
+// a from gen masked to mask, b a power of two below 2^max_shift
+inline bitops_inputs make_uniform_bitops_inputs(const uint32_t mask,
+                                                const uint32_t max_shift = 0) {
+  bitops_inputs inputs{.distribution = "uniform"};
+  xorshift_generator gen{};
+  for (uint32_t i = 0; i < bitops_inputs::size; ++i) {
+    inputs.a.push_back(gen() & mask);
+    inputs.b.push_back(max_shift ? uint32_t{1} << gen() % max_shift : 1);
+  }
+  return inputs;
+}
+
+// a and b as computed from consecutive T by a hot path
+template <typename F>
+bitops_inputs make_realistic_bitops_inputs(const uint32_t T0, F f) {
+  bitops_inputs inputs{.distribution = "realistic"};
+  for (uint32_t T = T0; T < T0 + bitops_inputs::size; ++T) {
+    const auto [a, b] = f(T);
+    inputs.a.push_back(a);
+    inputs.b.push_back(b);
+  }
+  return inputs;
+}
+
+int run_bitops_benchmark() {
+  std::cout << bitops_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<bitops_benchmark_result>(std::cout);
+  using u32 = uint32_t;
+  constexpr u32 T0 = 1'000'000;
+
+  // ctz of T + 1, i.e., hanoi value
+  benchmark_bitop(
+      "ctz", [](u32 a, u32) -> u32 { return ctz_naive(a); },
+      [](u32 a, u32) -> u32 { return std::countr_zero(a); },
+      make_uniform_bitops_inputs(~u32{}),
+      make_realistic_bitops_inputs(
+          T0, [](u32 T) { return std::pair{T + 1, 0u}; }),
+      out);
+
+  // log2 of T, i.e., bit length of T less one
+  benchmark_bitop(
+      "log2", [](u32 a, u32) -> u32 { return log2_naive(a); },
+      [](u32 a, u32) -> u32 { return 31 - std::countl_zero(a | 1); },
+      make_uniform_bitops_inputs(~u32{}),
+      make_realistic_bitops_inputs(T0,
+                                   [](u32 T) { return std::pair{T, 0u}; }),
+      out);
+
+  // bunch index arithmetic, as in calc_kb, at the largest S each serves
+  const auto kb_popcount_inputs = [](const u32 S) {
+    return make_realistic_bitops_inputs(
+        0, [S](u32 T) { return std::pair{2 * S - (1 + T % (S / 2 - 1)), 0u}; });
+  };
+  const auto kb_bitwidth_inputs = [](const u32 S) {
+    return make_realistic_bitops_inputs(
+        0, [S](u32 T) { return std::pair{1 + T % (S / 2 - 1), 0u}; });
+  };
+
+  benchmark_bitop(
+      "popcount_uint8", [](u32 a, u32) -> u32 { return popcount_uint8(a); },
+      [](u32 a, u32) -> u32 { return std::popcount(uint8_t(a)); },
+      make_uniform_bitops_inputs(0xFF), kb_popcount_inputs(128), out);
+
+  benchmark_bitop(
+      "popcount_uint16", [](u32 a, u32) -> u32 { return popcount_uint16(a); },
+      [](u32 a, u32) -> u32 { return std::popcount(uint16_t(a)); },
+      make_uniform_bitops_inputs(0xFFFF), kb_popcount_inputs(4096), out);
+
+  benchmark_bitop(
+      "bitwidth_uint8", [](u32 a, u32) -> u32 { return bitwidth_uint8(a); },
+      [](u32 a, u32) -> u32 { return std::bit_width(uint8_t(a)); },
+      make_uniform_bitops_inputs(0xFF), kb_bitwidth_inputs(256), out);
+
+  benchmark_bitop(
+      "bitwidth_uint16", [](u32 a, u32) -> u32 { return bitwidth_uint16(a); },
+      [](u32 a, u32) -> u32 { return std::bit_width(uint16_t(a)); },
+      make_uniform_bitops_inputs(0xFFFF), kb_bitwidth_inputs(4096), out);
+
+  // T against doubling steady stride, a power of two
+  const auto stride_inputs = make_realistic_bitops_inputs(
+      T0, [](u32 T) { return std::pair{T, _calc_stride<1024>(T)}; });
+
+  benchmark_bitop(
+      "modpow2",
+      [](u32 a, u32 b) -> u32 { return downstream::_auxlib::modpow2(a, b); },
+      [](u32 a, u32 b) -> u32 { return a % b; },
+      make_uniform_bitops_inputs(~u32{}, 32), stride_inputs, out);
+
+  benchmark_bitop(
+      "divpow2", [](u32 a, u32 b) -> u32 { return divpow2(a, b); },
+      [](u32 a, u32 b) -> u32 { return a >> std::countr_zero(b); },
+      make_uniform_bitops_inputs(~u32{}, 32), stride_inputs, out);
+
+  return 0;
+}
+#endif // #ifndef BENCHMARK_BITOPS_HPP_INCLUDE
@@ -0,0 +1,144 @@
+#pragma once
+#ifndef BENCHMARK_CONCURRENT_HPP_INCLUDE
+#define BENCHMARK_CONCURRENT_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <latch>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/downcast_value.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./surface/concurrent_surface.hpp"
+
+struct concurrent_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  uint32_t memory_bytes;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t num_threads;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,memory_bytes,num_items,"
+            "num_sites,num_threads,replicate,duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{}\n", algo_name, data_type,
+                       compiler_name, memory_bytes, num_items, num_sites,
+                       num_threads, replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const concurrent_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+template <typename algo, typename dtype, uint32_t num_sites>
+concurrent_benchmark_result
+time_concurrent_assign_storage_site(const uint32_t replicate,
+                                    const uint32_t num_items,
+                                    const uint32_t num_threads) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+  using surface_t = concurrent_surface<algo, dtype, num_sites>;
+
+  const auto surface = std::make_unique<surface_t>();
+  DoNotOptimize(*surface);
+
+  // hold producers at the starting line so thread spawn is not timed
+  std::latch start{1};
+  std::vector<std::jthread> producers;
+  producers.reserve(num_threads);
+  for (uint32_t thread = 0; thread < num_threads; ++thread) {
+    const uint32_t quota =
+        num_items / num_threads + (thread < num_items % num_threads);
+    producers.emplace_back([&surface, &start, quota, thread]() {
+      xorshift_generator gen{};
+      gen.state += thread; // decorrelate producers
+      start.wait();
+      for (uint32_t i = 0; i < quota; ++i)
+        surface->ingest(downcast_value<dtype>(gen()));
+      DoNotOptimize(gen.state);
+    });
+  }
+
+  const auto t1 = high_resolution_clock::now();
+  start.count_down();
+  for (auto &producer : producers)
+    producer.join();
+  const auto t2 = high_resolution_clock::now();
+  DoNotOptimize(*surface);
+
+  return {.algo_name = algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .memory_bytes = sizeof(surface_t),
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .num_threads = num_threads,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+template <typename algo, typename dtype, uint32_t num_sites, typename OutputIt>
+void benchmark_concurrent_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 10;
+  const uint32_t max_threads =
+      std::max(std::thread::hardware_concurrency(), 1u);
+  for (const uint32_t num_items : {100'000, 1'000'000}) {
+    for (uint32_t num_threads = 1; num_threads <= max_threads; ++num_threads) {
+      uint32_t replicate{};
+      std::generate_n(
+          out, num_replicates, [num_items, num_threads, &replicate]() {
+            const auto env_var =
+                std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+            // prevent compiler from knowing num_items in advance
+            const uint32_t obfuscated_num_items =
+                num_items + std::strlen(env_var);
+            return time_concurrent_assign_storage_site<algo, dtype, num_sites>(
+                replicate++, obfuscated_num_items, num_threads);
+          });
+    }
+  }
+}
+
+template <typename algo, typename OutputIt>
+void benchmark_concurrent_assign_storage_site(OutputIt out) {
+  benchmark_concurrent_assign_storage_site_<algo, uint32_t, 4096>(out);
+  benchmark_concurrent_assign_storage_site_<algo, uint32_t, 1024>(out);
+  benchmark_concurrent_assign_storage_site_<algo, uint32_t, 256>(out);
+  benchmark_concurrent_assign_storage_site_<algo, uint32_t, 64>(out);
+}
+
+int run_concurrent_benchmark() {
+  std::cout << concurrent_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<concurrent_benchmark_result>(std::cout);
+  benchmark_concurrent_assign_storage_site<dstream_stretched_algo>(out);
+  benchmark_concurrent_assign_storage_site<dstream_tilted_algo>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_CONCURRENT_HPP_INCLUDE
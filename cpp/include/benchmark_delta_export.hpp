@@ -0,0 +1,180 @@
+#pragma once
+#ifndef BENCHMARK_DELTA_EXPORT_HPP_INCLUDE
+#define BENCHMARK_DELTA_EXPORT_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./benchmark.hpp"
+#include "./ingest/dirty_ingest.hpp"
+#include "./surface/dirty_surface.hpp"
+
+struct delta_export_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  std::string_view tracking;
+  uint32_t checkpoint_interval;
+  uint32_t num_checkpoints;
+  uint64_t export_bytes;
+  uint32_t memory_bytes;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,isa,tracking,checkpoint_interval,"
+            "num_checkpoints,export_bytes,memory_bytes,num_items,num_sites,"
+            "replicate,duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, get_multiversion_isa_name(),
+                       tracking, checkpoint_interval, num_checkpoints,
+                       export_bytes, memory_bytes, num_items, num_sites,
+                       replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const delta_export_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+template <typename algo, typename dtype, uint32_t num_sites, bool track_dirty>
+delta_export_benchmark_result
+time_delta_export_assign_storage_site(const uint32_t replicate,
+                                      const uint32_t num_items,
+                                      const uint32_t checkpoint_interval) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+
+  uint64_t export_bytes{};
+  const auto t1 = high_resolution_clock::now();
+  const auto memory_bytes =
+      execute_dirty_assign_storage_site<algo, dtype, num_sites, track_dirty>(
+          num_items, checkpoint_interval, export_bytes);
+  const auto t2 = high_resolution_clock::now();
+
+  return {.algo_name = algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .tracking = track_dirty ? "dirty" : "none",
+          .checkpoint_interval = checkpoint_interval,
+          .num_checkpoints =
+              checkpoint_interval ? num_items / checkpoint_interval : 0,
+          .export_bytes = export_bytes,
+          .memory_bytes = memory_bytes,
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+// checkpoint interval zero times ingest alone, i.e., tracking overhead
+template <typename algo, typename dtype, uint32_t num_sites, bool track_dirty,
+          typename OutputIt>
+void benchmark_delta_export_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 10;
+  const uint32_t num_items = 1'000'000;
+  for (const uint32_t checkpoint_interval : {0, 256, 4096, 65536}) {
+    uint32_t replicate{};
+    std::generate_n(out, num_replicates, [checkpoint_interval, &replicate]() {
+      const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+      // prevent compiler from knowing num_items in advance
+      const uint32_t obfuscated_num_items = num_items + std::strlen(env_var);
+      return time_delta_export_assign_storage_site<algo, dtype, num_sites,
+                                                   track_dirty>(
+          replicate++, obfuscated_num_items, checkpoint_interval);
+    });
+  }
+}
+
+template <typename algo, typename dtype, uint32_t num_sites, typename OutputIt>
+void benchmark_delta_export_assign_storage_site__(OutputIt out) {
+  benchmark_delta_export_assign_storage_site_<algo, dtype, num_sites, false>(
+      out);
+  benchmark_delta_export_assign_storage_site_<algo, dtype, num_sites, true>(
+      out);
+}
+
+template <typename algo, typename OutputIt>
+void benchmark_delta_export_assign_storage_site(OutputIt out) {
+  benchmark_delta_export_assign_storage_site__<algo, uint32_t, 4096>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint32_t, 1024>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint32_t, 256>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint32_t, 64>(out);
+
+  benchmark_delta_export_assign_storage_site__<algo, uint8_t, 4096>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint8_t, 1024>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint8_t, 256>(out);
+  benchmark_delta_export_assign_storage_site__<algo, uint8_t, 64>(out);
+}
+
+// round trips two deltas through a replica, the second dirtying only the
+// last site, so exports must stop cleanly at the end of the surface
+template <typename dtype, uint32_t num_sites, bool track_dirty>
+bool check_delta_export() {
+  using surface_t = dirty_surface<dtype, num_sites, track_dirty>;
+  const auto surface = std::make_unique<surface_t>();
+  const auto replica = std::make_unique<surface_t>();
+  std::vector<uint8_t> buffer;
+
+  for (const uint32_t k : {0u, 1u, num_sites / 2, num_sites - 2, num_sites - 1})
+    surface->store(k, static_cast<dtype>(k + 1));
+  surface->export_delta(std::back_inserter(buffer));
+  replica->apply_delta(std::begin(buffer), std::end(buffer));
+
+  buffer.clear();
+  surface->store(num_sites - 1, static_cast<dtype>(num_sites + 7));
+  surface->export_delta(std::back_inserter(buffer));
+  replica->apply_delta(std::begin(buffer), std::end(buffer));
+
+  for (uint32_t k = 0; k < num_sites; ++k)
+    if (surface->load(k) != replica->load(k))
+      return false;
+  return true;
+}
+
+template <typename dtype> bool check_delta_export_() {
+  return (check_delta_export<dtype, 4096, true>() &&
+          check_delta_export<dtype, 1024, true>() &&
+          check_delta_export<dtype, 256, true>() &&
+          check_delta_export<dtype, 64, true>() &&
+          check_delta_export<dtype, 64, false>());
+}
+
+int run_delta_export_benchmark() {
+  if (!check_delta_export_<uint32_t>() || !check_delta_export_<uint8_t>()) {
+    std::cerr << "delta export round trip failed\n";
+    return 1;
+  }
+
+  std::cout << delta_export_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<delta_export_benchmark_result>(std::cout);
+  benchmark_delta_export_assign_storage_site<dstream_steady_algo_>(out);
+  benchmark_delta_export_assign_storage_site<dstream_stretched_algo>(out);
+  benchmark_delta_export_assign_storage_site<dstream_tilted_algo>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_DELTA_EXPORT_HPP_INCLUDE
@@ -0,0 +1,209 @@
+#pragma once
+#ifndef BENCHMARK_DOWNSIZE_HPP_INCLUDE
+#define BENCHMARK_DOWNSIZE_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/downcast_value.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./benchmark.hpp"
+#include "./surface/downsize_surface.hpp"
+
+struct downsize_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  std::string_view method;
+  uint32_t population_size;
+  uint32_t num_lost_sites;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,isa,method,population_size,"
+            "num_lost_sites,num_items,num_sites,replicate,duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, get_isa_name(), method,
+                       population_size, num_lost_sites, num_items, num_sites,
+                       replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const downsize_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+// fills every surface of the population as of time num_items
+template <typename dstream_algo, typename dtype, uint32_t num_sites>
+void fill_downsize_population(const std::span<dtype> population,
+                              const uint32_t num_items) {
+  xorshift_generator gen{};
+  for (uint32_t T = 0; T < num_items; ++T) {
+    const auto k = dstream_algo::_assign_storage_site(num_sites, T);
+    const auto data = downcast_value<dtype>(gen());
+    if (k != num_sites)
+      population[k] = data;
+  }
+  for (size_t i = num_sites; i < population.size(); i += num_sites)
+    std::copy_n(std::begin(population), num_sites, std::begin(population) + i);
+}
+
+template <typename dstream_algo, typename dtype, uint32_t num_sites>
+downsize_benchmark_result time_downsize(const uint32_t replicate,
+                                        const uint32_t num_items,
+                                        const uint32_t population_size) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+
+  std::vector<dtype> population(size_t{population_size} * num_sites);
+  fill_downsize_population<dstream_algo, dtype, num_sites>(population,
+                                                           num_items);
+  DoNotOptimize(population.data());
+
+  const auto t1 = high_resolution_clock::now();
+  const auto plan = downsize_population<dstream_algo, num_sites>(
+      std::span<dtype>{population}, num_items, dtype{});
+  DoNotOptimize(population.data());
+  const auto t2 = high_resolution_clock::now();
+
+  return {.algo_name = dstream_algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .method = "downsize",
+          .population_size = population_size,
+          .num_lost_sites = plan.num_lost,
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+// reference cost: re-ingest the whole stream into each smaller surface,
+// which is only possible if the stream can be replayed
+template <typename dstream_algo, typename dtype, uint32_t num_sites>
+downsize_benchmark_result time_rebuild(const uint32_t replicate,
+                                       const uint32_t num_items,
+                                       const uint32_t population_size) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+
+  const auto t1 = high_resolution_clock::now();
+  for (uint32_t i = 0; i < population_size; ++i)
+    execute_dstream_assign_storage_site<dstream_algo, dtype, num_sites / 2>(
+        num_items);
+  const auto t2 = high_resolution_clock::now();
+
+  return {.algo_name = dstream_algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .method = "rebuild",
+          .population_size = population_size,
+          .num_lost_sites = 0,
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+// downsizes one surface and compares it against the smaller surface built by
+// ingesting the stream directly, except at lost sites, which must hold the
+// fill value and are only allowed for retention that does not nest
+template <typename dstream_algo, typename dtype, uint32_t num_sites>
+bool check_downsize(const uint32_t num_items, const bool may_lose) {
+  constexpr uint32_t half_sites = num_sites / 2;
+  const dtype fill_value = static_cast<dtype>(~dtype{});
+
+  std::vector<dtype> surface(num_sites);
+  fill_downsize_population<dstream_algo, dtype, num_sites>(surface, num_items);
+  const auto plan = downsize_population<dstream_algo, num_sites>(
+      std::span<dtype>{surface}, num_items, fill_value);
+  if (plan.num_lost && !may_lose)
+    return false;
+
+  std::vector<dtype> rebuilt(half_sites, fill_value);
+  fill_downsize_population<dstream_algo, dtype, half_sites>(rebuilt,
+                                                            num_items);
+  for (uint32_t k = 0; k < half_sites; ++k)
+    if (surface[k] != (plan.lost.test(k) ? fill_value : rebuilt[k]))
+      return false;
+  return true;
+}
+
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          typename OutputIt>
+void benchmark_downsize_(OutputIt out) {
+  const uint32_t num_replicates = 5;
+  for (const uint32_t num_items : {10'000, 1'000'000}) {
+    for (const uint32_t population_size : {1, 16, 256}) {
+      const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+      // prevent compiler from knowing num_items in advance
+      const uint32_t obfuscated_num_items = num_items + std::strlen(env_var);
+      for (uint32_t replicate = 0; replicate < num_replicates; ++replicate) {
+        *out++ = time_downsize<dstream_algo, dtype, num_sites>(
+            replicate, obfuscated_num_items, population_size);
+        *out++ = time_rebuild<dstream_algo, dtype, num_sites>(
+            replicate, obfuscated_num_items, population_size);
+      }
+    }
+  }
+}
+
+template <typename dstream_algo> bool check_downsize_(const bool may_lose) {
+  for (const uint32_t num_items : {100, 10'000, 1'000'000})
+    if (!check_downsize<dstream_algo, uint32_t, 4096>(num_items, may_lose) ||
+        !check_downsize<dstream_algo, uint32_t, 1024>(num_items, may_lose) ||
+        !check_downsize<dstream_algo, uint32_t, 256>(num_items, may_lose) ||
+        !check_downsize<dstream_algo, uint32_t, 64>(num_items, may_lose))
+      return false;
+  return true;
+}
+
+template <typename dstream_algo, typename OutputIt>
+void benchmark_downsize(OutputIt out) {
+  benchmark_downsize_<dstream_algo, uint32_t, 4096>(out);
+  benchmark_downsize_<dstream_algo, uint32_t, 1024>(out);
+  benchmark_downsize_<dstream_algo, uint32_t, 256>(out);
+  benchmark_downsize_<dstream_algo, uint32_t, 64>(out);
+}
+
+// downstream generic algorithms, as native kernels only support select sizes
+int run_downsize_benchmark() {
+  // steady and stretched retention nest, so only tilted may lose items
+  if (!check_downsize_<dstream_steady_algo_>(false) ||
+      !check_downsize_<dstream_stretched_algo_>(false) ||
+      !check_downsize_<dstream_tilted_algo_>(true)) {
+    std::cerr << "downsized surfaces differ from rebuilt ones\n";
+    return 1;
+  }
+
+  std::cout << downsize_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<downsize_benchmark_result>(std::cout);
+  benchmark_downsize<dstream_steady_algo_>(out);
+  benchmark_downsize<dstream_stretched_algo_>(out);
+  benchmark_downsize<dstream_tilted_algo_>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_DOWNSIZE_HPP_INCLUDE
@@ -0,0 +1,168 @@
+#pragma once
+#ifndef BENCHMARK_GATHER_HPP_INCLUDE
+#define BENCHMARK_GATHER_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./aux/benchmark_clock.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/downcast_value.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./ingest/gather_ingest.hpp"
+#include "./surface/population_array.hpp"
+
+struct gather_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  std::string_view method;
+  uint32_t region_bytes; // zero for the reference loop
+  uint64_t memory_bytes; // population plus scratch
+  uint32_t num_surfaces;
+  uint32_t num_sites;
+  uint32_t num_writes;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,isa,clock,method,region_bytes,"
+            "memory_bytes,num_surfaces,num_sites,num_writes,replicate,"
+            "duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, get_multiversion_isa_name(),
+                       benchmark_clock::get().get_name(), method, region_bytes,
+                       memory_bytes, num_surfaces, num_sites, num_writes,
+                       replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const gather_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+// num_writes writes in batches of num_surfaces, each to a surface drawn with
+// replacement; surfaces start scattered over T < 2^24, then advance by one
+// per write, so no two share a T for long
+template <typename dtype>
+std::vector<population_batch<dtype>>
+make_population_batches(const uint32_t num_surfaces,
+                        const uint32_t num_writes) {
+  xorshift_generator gen{};
+  std::vector<uint32_t> Ts(num_surfaces);
+  for (auto &T : Ts)
+    T = gen() >> 8;
+
+  std::vector<population_batch<dtype>> batches;
+  for (uint32_t written = 0; written < num_writes;) {
+    auto &batch = batches.emplace_back();
+    const uint32_t batch_size = std::min(num_surfaces, num_writes - written);
+    for (uint32_t j = 0; j < batch_size; ++j) {
+      const uint32_t surface = (uint64_t{gen()} * num_surfaces) >> 32;
+      batch.push_back(surface, Ts[surface]++, downcast_value<dtype>(gen()));
+    }
+    written += batch_size;
+  }
+  return batches;
+}
+
+// ingest is the reference loop, or a gather_ingest reporting its region and
+// scratch sizes
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          typename ingest_t>
+gather_benchmark_result time_population_assign_storage_site(
+    ingest_t &&ingest, population_array<dtype, num_sites> &population,
+    const std::vector<population_batch<dtype>> &batches,
+    const uint32_t num_writes, const uint32_t replicate) {
+  const auto &clock = benchmark_clock::get();
+  const auto t1 = clock.now();
+  for (const auto &batch : batches)
+    ingest(population, batch);
+  const auto t2 = clock.now();
+
+  constexpr bool is_gather = requires { ingest.get_memory_bytes(); };
+  uint32_t region_bytes{};
+  uint64_t scratch_bytes{};
+  if constexpr (is_gather) {
+    region_bytes = ingest.get_region_bytes();
+    scratch_bytes = ingest.get_memory_bytes();
+  }
+
+  return {.algo_name = dstream_algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .method = is_gather ? "gather" : "loop",
+          .region_bytes = region_bytes,
+          .memory_bytes = population.get_memory_bytes() + scratch_bytes,
+          .num_surfaces = population.get_num_surfaces(),
+          .num_sites = num_sites,
+          .num_writes = num_writes,
+          .replicate = replicate,
+          .duration_s = clock.elapsed_s(t1, t2)};
+}
+
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          typename OutputIt>
+void benchmark_gather_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 5;
+  const uint32_t num_writes = 1 << 22;
+  for (const uint32_t num_surfaces : {10'000, 100'000, 1'000'000}) {
+    const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+    // prevent compiler from knowing num_writes in advance
+    const uint32_t obfuscated_num_writes = num_writes + std::strlen(env_var);
+    const auto batches =
+        make_population_batches<dtype>(num_surfaces, obfuscated_num_writes);
+
+    // fault in pages up front, so only steady-state site writes are timed
+    population_array<dtype, num_sites> population{num_surfaces};
+    std::memset(population.data(), 0, population.get_memory_bytes());
+    DoNotOptimize(*population.data());
+
+    gather_ingest<dstream_algo, dtype, num_sites, 4096> gather_4k;
+    gather_ingest<dstream_algo, dtype, num_sites, 65536> gather_64k;
+    for (uint32_t replicate = 0; replicate < num_replicates; ++replicate) {
+      *out++ = time_population_assign_storage_site<dstream_algo>(
+          execute_loop_population_assign_storage_site<dstream_algo, dtype,
+                                                      num_sites>,
+          population, batches, obfuscated_num_writes, replicate);
+      *out++ = time_population_assign_storage_site<dstream_algo>(
+          gather_4k, population, batches, obfuscated_num_writes, replicate);
+      *out++ = time_population_assign_storage_site<dstream_algo>(
+          gather_64k, population, batches, obfuscated_num_writes, replicate);
+    }
+  }
+}
+
+template <typename dstream_algo, typename OutputIt>
+void benchmark_gather_assign_storage_site(OutputIt out) {
+  benchmark_gather_assign_storage_site_<dstream_algo, uint32_t, 256>(out);
+  benchmark_gather_assign_storage_site_<dstream_algo, uint32_t, 64>(out);
+}
+
+int run_gather_benchmark() {
+  std::cout << gather_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<gather_benchmark_result>(std::cout);
+  benchmark_gather_assign_storage_site<dstream_stretched_algo>(out);
+  benchmark_gather_assign_storage_site<dstream_tilted_algo>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_GATHER_HPP_INCLUDE
@@ -0,0 +1,164 @@
+#pragma once
+#ifndef BENCHMARK_LARGE_SURFACE_HPP_INCLUDE
+#define BENCHMARK_LARGE_SURFACE_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "../downstream/include/downstream/dstream/dstream.hpp"
+
+#include "./algo/control_throwaway_algo.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./aux/wide_record.hpp"
+#include "./ingest/prefetch_ingest.hpp"
+#include "./surface/heap_array.hpp"
+#include "./surface/hugepage_array.hpp"
+
+struct large_surface_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  std::string_view storage;
+  uint32_t prefetch_distance;
+  uint32_t memory_bytes;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,isa,storage,prefetch_distance,"
+            "memory_bytes,num_items,num_sites,replicate,duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, get_multiversion_isa_name(),
+                       storage, prefetch_distance, memory_bytes, num_items,
+                       num_sites, replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const large_surface_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+template <typename algo, typename dtype, uint32_t num_sites,
+          template <typename, uint32_t> typename storage_t, uint32_t distance>
+large_surface_benchmark_result
+time_large_surface_assign_storage_site(const uint32_t replicate,
+                                       const uint32_t num_items) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+
+  // fault in pages up front, so only steady-state site writes are timed
+  storage_t<dtype, num_sites> storage;
+  std::memset(storage.data(), 0, sizeof(dtype) * num_sites);
+  DoNotOptimize(storage);
+
+  const auto t1 = high_resolution_clock::now();
+  const auto memory_bytes =
+      execute_prefetch_assign_storage_site<algo, dtype, num_sites, distance>(
+          storage, num_items);
+  const auto t2 = high_resolution_clock::now();
+
+  return {.algo_name = algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .storage = storage_t<dtype, num_sites>::get_storage_name(),
+          .prefetch_distance = distance,
+          .memory_bytes = memory_bytes,
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+template <typename algo, typename dtype, uint32_t num_sites,
+          template <typename, uint32_t> typename storage_t, uint32_t distance,
+          typename OutputIt>
+void benchmark_large_surface_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 10;
+  for (const uint32_t num_items : {4'000'000}) {
+    uint32_t replicate{};
+    std::generate_n(out, num_replicates, [num_items, &replicate]() {
+      const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+      // prevent compiler from knowing num_items in advance
+      const uint32_t obfuscated_num_items = num_items + std::strlen(env_var);
+      return time_large_surface_assign_storage_site<algo, dtype, num_sites,
+                                                    storage_t, distance>(
+          replicate++, obfuscated_num_items);
+    });
+  }
+}
+
+template <typename algo, typename dtype, uint32_t num_sites,
+          template <typename, uint32_t> typename storage_t, typename OutputIt>
+void benchmark_large_surface_assign_storage_site__(OutputIt out) {
+  benchmark_large_surface_assign_storage_site_<algo, dtype, num_sites,
+                                               storage_t, 0>(out);
+  benchmark_large_surface_assign_storage_site_<algo, dtype, num_sites,
+                                               storage_t, 4>(out);
+  benchmark_large_surface_assign_storage_site_<algo, dtype, num_sites,
+                                               storage_t, 8>(out);
+  benchmark_large_surface_assign_storage_site_<algo, dtype, num_sites,
+                                               storage_t, 16>(out);
+  benchmark_large_surface_assign_storage_site_<algo, dtype, num_sites,
+                                               storage_t, 32>(out);
+}
+
+template <typename algo, typename dtype, typename OutputIt>
+void benchmark_large_surface_assign_storage_site___(OutputIt out) {
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 20,
+                                                heap_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 18,
+                                                heap_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 16,
+                                                heap_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 14,
+                                                heap_array>(out);
+
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 20,
+                                                hugepage_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 18,
+                                                hugepage_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 16,
+                                                hugepage_array>(out);
+  benchmark_large_surface_assign_storage_site__<algo, dtype, 1 << 14,
+                                                hugepage_array>(out);
+}
+
+template <typename algo, typename OutputIt>
+void benchmark_large_surface_assign_storage_site(OutputIt out) {
+  benchmark_large_surface_assign_storage_site___<algo, uint64_t>(out);
+  benchmark_large_surface_assign_storage_site___<algo, wide_record<64>>(out);
+}
+
+// site kernels in ./algo/ dispatch only up to S = 4096, so large surfaces use
+// downstream's generic implementations
+int run_large_surface_benchmark() {
+  std::cout << large_surface_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<large_surface_benchmark_result>(std::cout);
+  using namespace downstream::dstream;
+  benchmark_large_surface_assign_storage_site<control_throwaway_algo>(out);
+  benchmark_large_surface_assign_storage_site<steady_algo_<uint32_t>>(out);
+  benchmark_large_surface_assign_storage_site<stretched_algo_<uint32_t>>(out);
+  benchmark_large_surface_assign_storage_site<tilted_algo_<uint32_t>>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_LARGE_SURFACE_HPP_INCLUDE
@@ -0,0 +1,165 @@
+#pragma once
+#ifndef BENCHMARK_LOOKUP_TABLES_HPP_INCLUDE
+#define BENCHMARK_LOOKUP_TABLES_HPP_INCLUDE
+
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../downstream/include/downstream/_auxlib/modpow2.hpp"
+
+#include "./algo/dstream_helpers.hpp"
+#include "./aux/benchmark_clock.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./benchmark_bitops.hpp"
+
+struct lookup_tables_benchmark_result {
+  std::string_view quantity;
+  std::string_view implementation;
+  std::string_view distribution;
+  std::string_view mode;
+  uint32_t num_sites;
+  uint32_t table_bytes;
+  uint32_t num_ops;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("quantity,implementation,distribution,mode,num_sites,table_bytes,"
+            "compiler,isa,clock,num_ops,replicate,duration_s,ns_per_op\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{},{}\n", quantity,
+                       implementation, distribution, mode, num_sites,
+                       table_bytes, compiler_name, get_isa_name(),
+                       benchmark_clock::get().get_name(), num_ops, replicate,
+                       duration_s, duration_s * 1e9 / num_ops);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const lookup_tables_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+template <typename F, typename OutputIt>
+void benchmark_lookup_table_(const std::string_view quantity,
+                             const std::string_view implementation,
+                             const uint32_t num_sites,
+                             const uint32_t table_bytes, F f,
+                             const bitops_inputs &inputs, OutputIt out) {
+  const uint32_t num_replicates = 10;
+  const uint32_t num_passes = 512;
+  const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+  const uint32_t zero = std::strlen(env_var);
+  const auto &clock = benchmark_clock::get();
+
+  for (uint32_t replicate = 0; replicate < num_replicates; ++replicate) {
+    for (const std::string_view mode : {"latency", "throughput"}) {
+      const auto t1 = clock.now();
+      uint32_t result = mode == "latency"
+                            ? run_bitop_latency(f, inputs, num_passes, zero)
+                            : run_bitop_throughput(f, inputs, num_passes);
+      const auto t2 = clock.now();
+      DoNotOptimize(result);
+
+      *out++ = lookup_tables_benchmark_result{
+          .quantity = quantity,
+          .implementation = implementation,
+          .distribution = inputs.distribution,
+          .mode = mode,
+          .num_sites = num_sites,
+          .table_bytes = table_bytes,
+          .num_ops = num_passes * bitops_inputs::size,
+          .replicate = replicate,
+          .duration_s = clock.elapsed_s(t1, t2)};
+    }
+  }
+}
+
+// blT and h of consecutive T, all h if h_min is zero
+inline bitops_inputs make_blT_h_inputs(const uint32_t T0,
+                                       const uint32_t h_min) {
+  auto inputs = make_realistic_bitops_inputs(T0, [h_min](const uint32_t i) {
+    const uint32_t T = ((i << h_min) | ((1u << h_min) - 1));
+    return std::pair{uint32_t(std::bit_width(T)),
+                     uint32_t(std::countr_zero(T + 1))};
+  });
+  if (h_min)
+    inputs.distribution = "high_h";
+  return inputs;
+}
+
+// a is b_l, as assigned by tilted for consecutive T
+template <uint32_t S> bitops_inputs make_tilted_b_l_inputs(const uint32_t T0) {
+  return make_realistic_bitops_inputs(T0, [](const uint32_t T) {
+    const uint32_t blT = std::bit_width(T);
+    const uint32_t h = std::countr_zero(T + 1);
+    const uint32_t i = T >> (h + 1);
+    return std::pair{downstream::_auxlib::modpow2(i, calc_B<S>(blT, h)), 0u};
+  });
+}
+
+// calc computes from scratch, full tabulates every argument, and compact
+// stores a residual per b_l (kb) or a hanoi value window per blT (B)
+template <uint32_t S, typename OutputIt>
+void benchmark_lookup_tables_(OutputIt out) {
+  using u32 = uint32_t;
+  constexpr u32 T0 = 1'000'000;
+
+  const auto kb_uniform = make_uniform_bitops_inputs(S / 2 - 1);
+  const auto kb_realistic = make_tilted_b_l_inputs<S>(T0);
+  for (const auto *inputs : {&kb_uniform, &kb_realistic}) {
+    benchmark_lookup_table_(
+        "kb", "calc", S, 0, [](u32 a, u32) -> u32 { return calc_kb<S>(a); },
+        *inputs, out);
+    benchmark_lookup_table_(
+        "kb", "full", S, sizeof(kb_table<S>),
+        [](u32 a, u32) -> u32 { return lookup_kb<S>(a); }, *inputs, out);
+    benchmark_lookup_table_(
+        "kb", "compact", S, sizeof(kb_compact_table<S>),
+        [](u32 a, u32) -> u32 { return lookup_kb_compact<S>(a); }, *inputs,
+        out);
+  }
+
+  const auto B_realistic = make_blT_h_inputs(T0, 0);
+  const auto B_high_h = make_blT_h_inputs(T0 >> 8, 8);
+  for (const auto *inputs : {&B_realistic, &B_high_h}) {
+    benchmark_lookup_table_(
+        "B", "calc", S, 0,
+        [](u32 a, u32 b) -> u32 { return calc_B<S>(a, b); }, *inputs, out);
+    benchmark_lookup_table_(
+        "B", "full", S, sizeof(B_table<S, 32>),
+        [](u32 a, u32 b) -> u32 { return lookup_B<S, 32>(a, b); }, *inputs,
+        out);
+    benchmark_lookup_table_(
+        "B", "compact", S, sizeof(B_compact_table<S>),
+        [](u32 a, u32 b) -> u32 { return lookup_B_compact<S>(a, b); },
+        *inputs, out);
+  }
+}
+
+int run_lookup_tables_benchmark() {
+  std::cout << lookup_tables_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<lookup_tables_benchmark_result>(std::cout);
+  benchmark_lookup_tables_<1024>(out);
+  benchmark_lookup_tables_<4096>(out);
+  benchmark_lookup_tables_<16384>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_LOOKUP_TABLES_HPP_INCLUDE
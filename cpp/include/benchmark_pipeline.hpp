@@ -0,0 +1,163 @@
+#pragma once
+#ifndef BENCHMARK_PIPELINE_HPP_INCLUDE
+#define BENCHMARK_PIPELINE_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "./algo/control_throwaway_algo.hpp"
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/get_isa_name.hpp"
+#include "./aux/name_value.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./aux/xorshift_rounds_generator.hpp"
+#include "./benchmark.hpp"
+#include "./ingest/coroutine_ingest.hpp"
+
+struct pipeline_benchmark_result {
+  std::string_view algo_name;
+  std::string_view data_type;
+  std::string_view producer;
+  std::string_view ingest_mode;
+  uint32_t batch_size;
+  uint32_t memory_bytes;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t replicate;
+  double duration_s;
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,data_type,compiler,isa,producer,ingest_mode,"
+            "batch_size,memory_bytes,num_items,num_sites,replicate,"
+            "duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       data_type, compiler_name, get_multiversion_isa_name(),
+                       producer, ingest_mode, batch_size, memory_bytes,
+                       num_items, num_sites, replicate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const pipeline_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+template <typename producer_t> std::string_view name_producer() {
+  if constexpr (std::is_same_v<producer_t, xorshift_generator>)
+    return "cheap";
+  else
+    return "expensive";
+}
+
+// batch_size zero times the tight loop of execute_dstream_assign_storage_site
+template <typename algo, typename dtype, uint32_t num_sites,
+          typename producer_t, uint32_t batch_size>
+pipeline_benchmark_result
+time_pipeline_assign_storage_site(const uint32_t replicate,
+                                  const uint32_t num_items) {
+  using std::chrono::duration_cast;
+  using std::chrono::high_resolution_clock;
+
+  const auto t1 = high_resolution_clock::now();
+  uint32_t memory_bytes;
+  if constexpr (batch_size == 0)
+    memory_bytes =
+        execute_dstream_assign_storage_site<algo, dtype, num_sites,
+                                            producer_t>(num_items);
+  else
+    memory_bytes =
+        execute_coroutine_assign_storage_site<algo, dtype, num_sites,
+                                              batch_size, producer_t>(
+            num_items);
+  const auto t2 = high_resolution_clock::now();
+
+  return {.algo_name = algo::get_algo_name(),
+          .data_type = name_value<dtype>(),
+          .producer = name_producer<producer_t>(),
+          .ingest_mode = batch_size ? "coroutine" : "tight",
+          .batch_size = batch_size,
+          .memory_bytes = memory_bytes,
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .duration_s =
+              duration_cast<std::chrono::duration<double>>(t2 - t1).count()};
+}
+
+template <typename algo, typename dtype, uint32_t num_sites,
+          typename producer_t, uint32_t batch_size, typename OutputIt>
+void benchmark_pipeline_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 10;
+  for (const uint32_t num_items : {100'000, 1'000'000}) {
+    uint32_t replicate{};
+    std::generate_n(out, num_replicates, [num_items, &replicate]() {
+      const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+      // prevent compiler from knowing num_items in advance
+      const uint32_t obfuscated_num_items = num_items + std::strlen(env_var);
+      return time_pipeline_assign_storage_site<algo, dtype, num_sites,
+                                               producer_t, batch_size>(
+          replicate++, obfuscated_num_items);
+    });
+  }
+}
+
+template <typename algo, uint32_t num_sites, typename producer_t,
+          typename OutputIt>
+void benchmark_pipeline_assign_storage_site__(OutputIt out) {
+  using dtype = uint32_t;
+  benchmark_pipeline_assign_storage_site_<algo, dtype, num_sites, producer_t,
+                                          0>(out);
+  benchmark_pipeline_assign_storage_site_<algo, dtype, num_sites, producer_t,
+                                          16>(out);
+  benchmark_pipeline_assign_storage_site_<algo, dtype, num_sites, producer_t,
+                                          64>(out);
+  benchmark_pipeline_assign_storage_site_<algo, dtype, num_sites, producer_t,
+                                          256>(out);
+}
+
+template <typename algo, typename OutputIt>
+void benchmark_pipeline_assign_storage_site(OutputIt out) {
+  using cheap_producer = xorshift_generator;
+  using expensive_producer = xorshift_rounds_generator<64>;
+
+  benchmark_pipeline_assign_storage_site__<algo, 4096, cheap_producer>(out);
+  benchmark_pipeline_assign_storage_site__<algo, 1024, cheap_producer>(out);
+  benchmark_pipeline_assign_storage_site__<algo, 256, cheap_producer>(out);
+  benchmark_pipeline_assign_storage_site__<algo, 64, cheap_producer>(out);
+
+  benchmark_pipeline_assign_storage_site__<algo, 4096, expensive_producer>(
+      out);
+  benchmark_pipeline_assign_storage_site__<algo, 1024, expensive_producer>(
+      out);
+  benchmark_pipeline_assign_storage_site__<algo, 256, expensive_producer>(
+      out);
+  benchmark_pipeline_assign_storage_site__<algo, 64, expensive_producer>(out);
+}
+
+int run_pipeline_benchmark() {
+  std::cout << pipeline_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<pipeline_benchmark_result>(std::cout);
+  benchmark_pipeline_assign_storage_site<control_throwaway_algo>(out);
+  benchmark_pipeline_assign_storage_site<dstream_stretched_algo>(out);
+  benchmark_pipeline_assign_storage_site<dstream_tilted_algo>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_PIPELINE_HPP_INCLUDE
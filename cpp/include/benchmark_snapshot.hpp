@@ -0,0 +1,154 @@
+#pragma once
+#ifndef BENCHMARK_SNAPSHOT_HPP_INCLUDE
+#define BENCHMARK_SNAPSHOT_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <latch>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./aux/benchmark_clock.hpp"
+#include "./aux/DoNotOptimize.hpp"
+#include "./aux/get_compiler_name.hpp"
+#include "./aux/xorshift_generator.hpp"
+#include "./surface/seqlock_surface.hpp"
+
+struct snapshot_benchmark_result {
+  std::string_view algo_name;
+  uint32_t poll_hz; // zero for no reader, max for a busy reader
+  uint32_t memory_bytes;
+  uint32_t num_items;
+  uint32_t num_sites;
+  uint32_t replicate;
+  uint64_t num_attempts;
+  uint64_t num_snapshots;
+  double duration_s; // writer only
+
+  static std::string_view make_csv_header() {
+    return ("algo_name,compiler,clock,poll_hz,memory_bytes,num_items,"
+            "num_sites,replicate,num_attempts,num_snapshots,success_rate,"
+            "duration_s\n");
+  }
+
+  std::string make_csv_row() const {
+    constexpr std::string_view compiler_name = get_compiler_name();
+    const double success_rate =
+        num_attempts ? double(num_snapshots) / num_attempts : 0.0;
+    return std::format("{},{},{},{},{},{},{},{},{},{},{},{}\n", algo_name,
+                       compiler_name, benchmark_clock::get().get_name(),
+                       poll_hz, memory_bytes, num_items, num_sites, replicate,
+                       num_attempts, num_snapshots, success_rate, duration_s);
+  }
+};
+
+namespace std {
+std::ostream &operator<<(std::ostream &os,
+                         const snapshot_benchmark_result &result) {
+  os << result.make_csv_row();
+  return os;
+}
+} // namespace std
+
+constexpr uint32_t snapshot_busy_poll_hz = UINT32_MAX;
+
+// times the writer ingesting num_items while a reader thread attempts a
+// snapshot poll_hz times per second, or back to back if busy
+template <typename algo, uint32_t num_sites>
+snapshot_benchmark_result
+time_snapshot_assign_storage_site(const uint32_t replicate,
+                                  const uint32_t num_items,
+                                  const uint32_t poll_hz) {
+  using surface_t = seqlock_surface<algo, uint32_t, num_sites>;
+  using snapshot_t = surface_t::snapshot;
+  using std::chrono::steady_clock;
+
+  const auto surface = std::make_unique<surface_t>();
+  const auto snapshot = std::make_unique<snapshot_t>();
+  std::atomic<bool> done{};
+  uint64_t num_attempts{};
+  uint64_t num_snapshots{};
+
+  std::latch start{1};
+  std::jthread reader;
+  if (poll_hz)
+    reader = std::jthread{[&]() {
+      const auto interval = std::chrono::nanoseconds{1'000'000'000 / poll_hz};
+      start.wait();
+      auto next_poll = steady_clock::now();
+      while (!done.load(std::memory_order_relaxed)) {
+        num_snapshots += surface->try_snapshot(*snapshot);
+        ++num_attempts;
+        if (poll_hz != snapshot_busy_poll_hz) {
+          next_poll += interval;
+          std::this_thread::sleep_until(next_poll);
+        }
+      }
+      DoNotOptimize(*snapshot);
+    }};
+
+  const auto &clock = benchmark_clock::get();
+  xorshift_generator gen{};
+  start.count_down();
+  const auto t1 = clock.now();
+  for (uint32_t i = 0; i < num_items; ++i)
+    surface->ingest(gen());
+  const auto t2 = clock.now();
+  done.store(true, std::memory_order_relaxed);
+  if (reader.joinable())
+    reader.join();
+  DoNotOptimize(*surface);
+
+  return {.algo_name = algo::get_algo_name(),
+          .poll_hz = poll_hz,
+          .memory_bytes = sizeof(surface_t),
+          .num_items = num_items,
+          .num_sites = num_sites,
+          .replicate = replicate,
+          .num_attempts = num_attempts,
+          .num_snapshots = num_snapshots,
+          .duration_s = clock.elapsed_s(t1, t2)};
+}
+
+template <typename algo, uint32_t num_sites, typename OutputIt>
+void benchmark_snapshot_assign_storage_site_(OutputIt out) {
+  const uint32_t num_replicates = 5;
+  const uint32_t num_items = 1 << 25;
+  for (const uint32_t poll_hz :
+       {0u, 10u, 100u, 1'000u, 10'000u, snapshot_busy_poll_hz}) {
+    uint32_t replicate{};
+    std::generate_n(out, num_replicates, [poll_hz, &replicate]() {
+      const auto env_var = std::getenv("DSTREAM_OBFUSCATE_UNSET_ENV_VAR") ?: "";
+      // prevent compiler from knowing num_items in advance
+      const uint32_t obfuscated_num_items = num_items + std::strlen(env_var);
+      return time_snapshot_assign_storage_site<algo, num_sites>(
+          replicate++, obfuscated_num_items, poll_hz);
+    });
+  }
+}
+
+template <typename algo, typename OutputIt>
+void benchmark_snapshot_assign_storage_site(OutputIt out) {
+  benchmark_snapshot_assign_storage_site_<algo, 4096>(out);
+  benchmark_snapshot_assign_storage_site_<algo, 256>(out);
+}
+
+int run_snapshot_benchmark() {
+  std::cout << snapshot_benchmark_result::make_csv_header();
+  auto out = std::ostream_iterator<snapshot_benchmark_result>(std::cout);
+  benchmark_snapshot_assign_storage_site<dstream_stretched_algo>(out);
+  benchmark_snapshot_assign_storage_site<dstream_tilted_algo>(out);
+  return 0;
+}
+#endif // #ifndef BENCHMARK_SNAPSHOT_HPP_INCLUDE
@@ -0,0 +1,106 @@
+#pragma once
+#ifndef FOOTPRINT_HPP_INCLUDE
+#define FOOTPRINT_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "./aux/csv_table.hpp"
+#include "./aux/function_output_iterator.hpp"
+#include "./benchmark.hpp"
+
+// static section and table sizes per algorithm, data type, and S, as written
+// by native/footprint.sh from standalone objects built by `make footprint`
+struct footprint_table {
+  // all but the algo_name, data_type, num_sites key
+  std::vector<std::string> columns;
+  std::map<std::tuple<std::string, std::string, uint32_t>,
+           std::vector<std::string>>
+      rows;
+};
+
+bool load_footprint(const std::string &path, footprint_table &footprint) {
+  std::ifstream file(path);
+  if (!file) {
+    std::cerr << "could not open footprint " << path << '\n';
+    return false;
+  }
+  const csv_table table = read_csv_table(file);
+
+  const auto algo_col = table.find_column("algo_name");
+  const auto dtype_col = table.find_column("data_type");
+  const auto sites_col = table.find_column("num_sites");
+  if (!algo_col || !dtype_col || !sites_col) {
+    std::cerr << "footprint " << path << " is missing required columns\n";
+    return false;
+  }
+
+  std::vector<size_t> value_cols;
+  for (size_t i = 0; i < table.header.size(); ++i)
+    if (i != *algo_col && i != *dtype_col && i != *sites_col) {
+      value_cols.push_back(i);
+      footprint.columns.push_back(table.header[i]);
+    }
+
+  for (const auto &row : table.rows) {
+    if (row.size() != table.header.size()) {
+      std::cerr << "skipping malformed footprint row\n";
+      continue;
+    }
+    const std::tuple<std::string, std::string, uint32_t> key{
+        row[*algo_col], row[*dtype_col], std::stoul(row[*sites_col])};
+    auto &values = footprint.rows[key];
+    for (const size_t i : value_cols)
+      values.push_back(row[i]);
+  }
+  return true;
+}
+
+// fields of a CSV line, with values spliced in after field position
+std::string splice_csv_line(const std::string_view line, const size_t position,
+                            const std::vector<std::string> &values) {
+  auto fields = split_csv_line(line.substr(0, line.find('\n')));
+  fields.insert(std::next(std::begin(fields), position + 1),
+                std::begin(values), std::end(values));
+
+  std::string res;
+  for (const auto &field : fields)
+    res += (res.empty() ? "" : ",") + field;
+  return res + '\n';
+}
+
+// benchmark CSV with footprint columns next to memory_bytes; configurations
+// missing from the footprint, e.g., record data types, get empty fields
+int run_footprint_benchmark(const std::string &path) {
+  footprint_table footprint;
+  if (!load_footprint(path, footprint))
+    return 2;
+
+  const auto header = split_csv_line(benchmark_result::make_csv_header());
+  const size_t memory_col = std::distance(
+      std::begin(header), std::ranges::find(header, "memory_bytes"));
+  const std::vector<std::string> missing(footprint.columns.size());
+
+  std::cout << splice_csv_line(benchmark_result::make_csv_header(),
+                               memory_col, footprint.columns);
+  benchmark_algos(function_output_iterator{
+      [&](const benchmark_result &result) {
+        const auto it = footprint.rows.find({std::string{result.algo_name},
+                                             std::string{result.data_type},
+                                             result.num_sites});
+        const auto &values =
+            it == std::end(footprint.rows) ? missing : it->second;
+        std::cout << splice_csv_line(result.make_csv_row(), memory_col,
+                                     values);
+      }});
+  return 0;
+}
+#endif // #ifndef FOOTPRINT_HPP_INCLUDE
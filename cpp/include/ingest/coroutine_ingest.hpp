@@ -0,0 +1,61 @@
+#pragma once
+#ifndef INGEST_COROUTINE_INGEST_HPP_INCLUDE
+#define INGEST_COROUTINE_INGEST_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/item_generator.hpp"
+#include "../aux/multiversion.hpp"
+#include "../aux/xorshift_generator.hpp"
+
+// producer stage: wraps any item source as a coroutine that co_yields items
+template <typename dtype, typename producer_t>
+item_generator<dtype> produce_items(producer_t &producer) {
+  while (true)
+    co_yield downcast_value<dtype>(producer());
+}
+
+// ingest stage: collects a batch of items from the producer coroutine,
+// computes sites for the whole batch, then flushes the batch to storage
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          uint32_t batch_size, typename producer_t = xorshift_generator>
+__attribute__((hot)) MULTIVERSION uint32_t
+execute_coroutine_assign_storage_site(const uint32_t num_items) {
+
+  using storage_t =
+      std::conditional_t<std::is_same_v<dtype, bool>, std::bitset<num_sites>,
+                         std::array<dtype, num_sites>>;
+  std::optional<storage_t> storage; // bypass zero-initialization
+  DoNotOptimize(*storage);
+  producer_t gen{};
+  auto items = produce_items<dtype>(gen);
+
+  std::array<dtype, batch_size> batch;
+  std::array<uint32_t, batch_size> sites;
+  for (uint32_t T0 = 0; T0 < num_items; T0 += batch_size) {
+    const uint32_t n = std::min(batch_size, num_items - T0);
+
+    for (uint32_t j = 0; j < n; ++j)
+      batch[j] = items();
+
+    for (uint32_t j = 0; j < n; ++j)
+      sites[j] = dstream_algo::_assign_storage_site(num_sites, T0 + j);
+
+    for (uint32_t j = 0; j < n; ++j)
+      if (sites[j] != num_sites)
+        (*storage)[sites[j]] = batch[j];
+  }
+
+  DoNotOptimize(*storage);
+  DoNotOptimize(gen.state);
+  return sizeof(storage_t) + sizeof(uint32_t /* T0 */) + sizeof(batch) +
+         sizeof(sites);
+}
+#endif // #ifndef INGEST_COROUTINE_INGEST_HPP_INCLUDE
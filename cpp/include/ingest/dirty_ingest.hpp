@@ -0,0 +1,53 @@
+#pragma once
+#ifndef INGEST_DIRTY_INGEST_HPP_INCLUDE
+#define INGEST_DIRTY_INGEST_HPP_INCLUDE
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/multiversion.hpp"
+#include "../aux/xorshift_generator.hpp"
+#include "../surface/dirty_surface.hpp"
+
+// ingests into a dirty_surface, exporting a delta every checkpoint_interval
+// items (never, if zero) and tallying exported bytes into num_export_bytes
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          bool track_dirty>
+__attribute__((hot)) MULTIVERSION uint32_t execute_dirty_assign_storage_site(
+    const uint32_t num_items, const uint32_t checkpoint_interval,
+    uint64_t &num_export_bytes) {
+
+  using surface_t = dirty_surface<dtype, num_sites, track_dirty>;
+  const auto surface = std::make_unique<surface_t>();
+  DoNotOptimize(*surface);
+
+  // worst case is a full snapshot, plus run headers
+  std::vector<uint8_t> buffer;
+  buffer.reserve(sizeof(dtype) * num_sites + 10 * num_sites);
+
+  xorshift_generator gen{};
+  uint32_t countdown = checkpoint_interval;
+  for (uint32_t T = 0; T < num_items; ++T) {
+    const auto k = dstream_algo::_assign_storage_site(num_sites, T);
+    const auto data = downcast_value<dtype>(gen());
+    if (k != num_sites)
+      surface->store(k, data);
+
+    if (checkpoint_interval && !--countdown) [[unlikely]] {
+      countdown = checkpoint_interval;
+      buffer.clear();
+      surface->export_delta(std::back_inserter(buffer));
+      num_export_bytes += buffer.size();
+      DoNotOptimize(buffer.data());
+    }
+  }
+
+  DoNotOptimize(*surface);
+  DoNotOptimize(gen.state);
+  return surface_t::get_memory_bytes() + sizeof(uint32_t /* T */);
+}
+#endif // #ifndef INGEST_DIRTY_INGEST_HPP_INCLUDE
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef INGEST_GATHER_INGEST_HPP_INCLUDE
+#define INGEST_GATHER_INGEST_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/multiversion.hpp"
+#include "../surface/population_array.hpp"
+
+// writes bound for a population of surfaces, each surface at its own T, in
+// the arbitrary order an asynchronous agent-based model produces them
+template <typename dtype> struct population_batch {
+  std::vector<uint32_t> surfaces; // surface index of each write...
+  std::vector<uint32_t> Ts;       // ... that surface's T at the write...
+  std::vector<dtype> values;      // ... and the value written
+
+  void push_back(const uint32_t surface, const uint32_t T, const dtype value) {
+    surfaces.push_back(surface);
+    Ts.push_back(T);
+    values.push_back(value);
+  }
+
+  uint32_t size() const { return surfaces.size(); }
+};
+
+// reference: assign and store each write in batch order
+template <typename dstream_algo, typename dtype, uint32_t num_sites>
+__attribute__((hot)) MULTIVERSION void
+execute_loop_population_assign_storage_site(
+    population_array<dtype, num_sites> &population,
+    const population_batch<dtype> &batch) {
+  for (uint32_t j = 0; j < batch.size(); ++j) {
+    const uint32_t k =
+        dstream_algo::_assign_storage_site(num_sites, batch.Ts[j]);
+    if (k != num_sites)
+      population.surface(batch.surfaces[j])[k] = batch.values[j];
+  }
+  DoNotOptimize(*population.data());
+}
+
+// Batched ingest in three passes. First, sites for the whole batch, with no
+// stores into the population in between, so iterations are independent and
+// the compiler is free to vectorize or overlap the site kernels. Discarded
+// writes drop out here. Second, a stable LSD radix sort of the kept writes on
+// the region_bytes-sized memory region they land in, a digit of radix_bits
+// per pass. Third, the scatter, now walking the population region by region
+// rather than at random. Stable sorting keeps batch order among writes to the
+// same site, so the last one still wins, as in the reference loop.
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          uint32_t region_bytes, uint32_t radix_bits = 8>
+class gather_ingest {
+  static_assert(std::has_single_bit(region_bytes));
+  static_assert(std::has_single_bit(sizeof(dtype)));
+  static constexpr uint32_t region_shift =
+      std::countr_zero(std::max<uint32_t>(region_bytes / sizeof(dtype), 1));
+  static constexpr uint32_t radix = 1 << radix_bits;
+
+  struct write_t {
+    uint32_t offset; // flat offset into the population
+    dtype value;
+  };
+
+  // scratch, reused across batches
+  std::vector<write_t> writes, sorted_writes;
+  std::array<uint32_t, radix> counts;
+
+public:
+  static uint32_t get_region_bytes() { return region_bytes; }
+
+  uint64_t get_memory_bytes() const {
+    return sizeof(write_t) * (writes.capacity() + sorted_writes.capacity()) +
+           sizeof(counts);
+  }
+
+  __attribute__((hot)) MULTIVERSION void
+  operator()(population_array<dtype, num_sites> &population,
+             const population_batch<dtype> &batch) {
+    const uint32_t n = batch.size();
+    writes.resize(n);
+    sorted_writes.resize(n);
+
+    // kept writes, compacted without branching
+    uint32_t m = 0;
+    for (uint32_t j = 0; j < n; ++j) {
+      const uint32_t k =
+          dstream_algo::_assign_storage_site(num_sites, batch.Ts[j]);
+      writes[m] = {batch.surfaces[j] * num_sites + k, batch.values[j]};
+      m += k != num_sites;
+    }
+
+    const uint32_t offset_bits =
+        std::bit_width(population.get_num_surfaces() * num_sites - 1);
+    for (uint32_t shift = region_shift; shift < offset_bits;
+         shift += radix_bits) {
+      counts.fill(0);
+      for (uint32_t i = 0; i < m; ++i)
+        ++counts[(writes[i].offset >> shift) % radix];
+
+      uint32_t start = 0;
+      for (auto &count : counts)
+        start += std::exchange(count, start);
+
+      for (uint32_t i = 0; i < m; ++i)
+        sorted_writes[counts[(writes[i].offset >> shift) % radix]++] =
+            writes[i];
+      std::swap(writes, sorted_writes);
+    }
+
+    dtype *const sites = population.data();
+    for (uint32_t i = 0; i < m; ++i)
+      sites[writes[i].offset] = writes[i].value;
+    DoNotOptimize(*sites);
+  }
+};
+#endif // #ifndef INGEST_GATHER_INGEST_HPP_INCLUDE
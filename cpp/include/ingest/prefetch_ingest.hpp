@@ -0,0 +1,53 @@
+#pragma once
+#ifndef INGEST_PREFETCH_INGEST_HPP_INCLUDE
+#define INGEST_PREFETCH_INGEST_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "../aux/DoNotOptimize.hpp"
+#include "../aux/downcast_value.hpp"
+#include "../aux/multiversion.hpp"
+#include "../aux/xorshift_generator.hpp"
+
+// computes the site for item T + distance while storing item T, so the write
+// to each site can be prefetched distance items ahead; distance zero
+// computes each site just in time, without prefetch
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          uint32_t distance, typename storage_t>
+__attribute__((hot)) MULTIVERSION uint32_t
+execute_prefetch_assign_storage_site(storage_t &storage,
+                                     const uint32_t num_items) {
+  static_assert(distance == 0 || std::has_single_bit(distance));
+
+  // sites for items T through T + distance - 1, indexed by T mod distance
+  std::array<uint32_t, std::max(distance, 1u)> upcoming;
+  for (uint32_t T = 0; T < distance; ++T)
+    upcoming[T] = dstream_algo::_assign_storage_site(num_sites, T);
+
+  xorshift_generator gen{};
+  for (uint32_t T = 0; T < num_items; ++T) {
+    uint32_t k;
+    if constexpr (distance == 0)
+      k = dstream_algo::_assign_storage_site(num_sites, T);
+    else {
+      auto &slot = upcoming[T % distance];
+      k = slot;
+      slot = dstream_algo::_assign_storage_site(num_sites, T + distance);
+      if (slot != num_sites)
+        __builtin_prefetch(&storage[slot], 1 /* write */);
+    }
+
+    const auto data = downcast_value<dtype>(gen());
+    if (k != num_sites)
+      storage[k] = data;
+  }
+
+  DoNotOptimize(storage);
+  DoNotOptimize(gen.state);
+  return sizeof(dtype) * num_sites + sizeof(upcoming) +
+         sizeof(uint32_t /* T */);
+}
+#endif // #ifndef INGEST_PREFETCH_INGEST_HPP_INCLUDE
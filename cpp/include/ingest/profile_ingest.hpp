@@ -0,0 +1,37 @@
+#pragma once
+#ifndef INGEST_PROFILE_INGEST_HPP_INCLUDE
+#define INGEST_PROFILE_INGEST_HPP_INCLUDE
+
+#include <cstdint>
+#include <vector>
+
+#include "../aux/access_profile.hpp"
+
+// replays the site schedule without storing items, emitting an access_profile
+// for every window_size items ingested (and any final partial window)
+template <typename dstream_algo, typename dtype, uint32_t num_sites,
+          typename OutputIt>
+OutputIt execute_profile_assign_storage_site(
+    const uint32_t num_items, const uint32_t window_size,
+    const std::vector<uint32_t> &cache_lines, OutputIt out) {
+
+  access_profiler profiler(uint64_t{sizeof(dtype)} * num_sites, cache_lines);
+  uint32_t countdown = window_size;
+  for (uint32_t T = 0; T < num_items; ++T) {
+    const auto k = dstream_algo::_assign_storage_site(num_sites, T);
+    if (k != num_sites)
+      profiler.record_write(uint64_t{sizeof(dtype)} * k, sizeof(dtype));
+    else
+      profiler.record_discard();
+
+    if (!--countdown) {
+      countdown = window_size;
+      *out++ = profiler.finish_window();
+    }
+  }
+  if (countdown != window_size)
+    *out++ = profiler.finish_window();
+
+  return out;
+}
+#endif // #ifndef INGEST_PROFILE_INGEST_HPP_INCLUDE
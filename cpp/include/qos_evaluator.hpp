@@ -0,0 +1,220 @@
+#pragma once
+#ifndef QOS_EVALUATOR_HPP_INCLUDE
+#define QOS_EVALUATOR_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "./algo/dstream_hybrid_algo.hpp"
+#include "./algo/dstream_stretched_algo.hpp"
+#include "./algo/dstream_tilted_algo.hpp"
+#include "./algo/ring_buffer_algo.hpp"
+#include "./algo/split_surfaces_algo.hpp"
+#include "./aux/gap_metrics.hpp"
+#include "./benchmark.hpp"
+#include "./surface/retained_times.hpp"
+
+struct qos_options {
+  uint32_t num_items = uint32_t{1} << 24;
+  uint32_t points_per_doubling = 8;
+  uint32_t num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+};
+
+std::string_view make_qos_csv_header() {
+  return ("algo_name,num_sites,num_items,num_retained,max_gap_size,"
+          "gap_size_cost,gap_size_cost_mean\n");
+}
+
+// distinct T up to num_items, points_per_doubling per doubling
+std::vector<uint32_t> make_qos_checkpoints(const qos_options &options) {
+  std::vector<uint32_t> checkpoints;
+  for (uint32_t j = 0;; ++j) {
+    const double T =
+        std::round(std::exp2(double(j) / options.points_per_doubling));
+    if (T >= options.num_items)
+      break;
+    if (checkpoints.empty() || checkpoints.back() != T)
+      checkpoints.push_back(T);
+  }
+  checkpoints.push_back(options.num_items);
+  return checkpoints;
+}
+
+// times must be sorted, as for calc_gap_metrics
+std::string make_qos_csv_row(const std::string_view algo_name,
+                             const uint32_t num_sites, const uint32_t T,
+                             const std::vector<uint32_t> &times) {
+  const auto metrics = calc_gap_metrics(times, T);
+  return std::format("{},{},{},{},{},{},{}\n", algo_name, num_sites, T,
+                     times.size(), metrics.max_gap_size,
+                     metrics.gap_size_cost, metrics.gap_size_cost_mean);
+}
+
+// hand-computed metrics for small sorted times, with and without the newest
+// ingest time retained
+bool check_gap_metrics() {
+  const auto near = [](const double a, const double b) {
+    return std::abs(a - b) < 1e-9;
+  };
+
+  // segments (0, 3], (3, 4], (4, 9] lose 2, 0, 4 items at depths 6, 5, 0
+  const std::vector<uint32_t> trailing{0, 3, 4};
+  const auto m1 = calc_gap_metrics(trailing, 10);
+  const double mean1 = (2 * (1. / 7 + 1. / 8 + 1. / 9) +
+                        4 * (1 + 1. / 2 + 1. / 3 + 1. / 4 + 1. / 5)) /
+                       10;
+  if (m1.max_gap_size != 4 || !near(m1.gap_size_cost, 4) ||
+      !near(m1.gap_size_cost_mean, mean1))
+    return false;
+
+  // segments (0, 3], (3, 9] lose 2, 5 items at depths 6, 0
+  const std::vector<uint32_t> retained{0, 3, 9};
+  const auto m2 = calc_gap_metrics(retained, 10);
+  const double mean2 = (2 * (1. / 7 + 1. / 8 + 1. / 9) +
+                        5 * (1 + 1. / 2 + 1. / 3 + 1. / 4 + 1. / 5 + 1. / 6)) /
+                       10;
+  return m2.max_gap_size == 5 && near(m2.gap_size_cost, 5) &&
+         near(m2.gap_size_cost_mean, mean2);
+}
+
+// advances one algorithm through T, emitting a CSV row at each checkpoint
+template <typename dstream_algo, uint32_t num_sites>
+std::string evaluate_qos(const std::vector<uint32_t> &checkpoints) {
+  using retained_times_t = retained_times<dstream_algo, num_sites>;
+  const auto retained = std::make_unique<retained_times_t>();
+  std::vector<uint32_t> times;
+  times.reserve(num_sites);
+
+  std::string rows;
+  for (const uint32_t T : checkpoints) {
+    while (retained->get_num_ingested() < T)
+      retained->ingest();
+
+    times.clear();
+    retained->for_each([&times](const uint32_t t) { times.push_back(t); });
+    rows += make_qos_csv_row(dstream_algo::get_algo_name(), num_sites, T,
+                             times);
+  }
+  return rows;
+}
+
+// as evaluate_qos, for separate steady and tilted surfaces of S/2 sites that
+// both ingest every item; an item retained by both counts once
+template <uint32_t num_sites>
+std::string evaluate_split_qos(const std::vector<uint32_t> &checkpoints) {
+  constexpr uint32_t half = num_sites / 2;
+  const auto steady =
+      std::make_unique<retained_times<dstream_steady_algo_, half>>();
+  const auto tilted =
+      std::make_unique<retained_times<dstream_tilted_algo_, half>>();
+  std::vector<uint32_t> steady_times, tilted_times, times;
+
+  std::string rows;
+  for (const uint32_t T : checkpoints) {
+    while (steady->get_num_ingested() < T) {
+      steady->ingest();
+      tilted->ingest();
+    }
+
+    steady_times.clear();
+    tilted_times.clear();
+    times.clear();
+    steady->for_each([&](const uint32_t t) { steady_times.push_back(t); });
+    tilted->for_each([&](const uint32_t t) { tilted_times.push_back(t); });
+    std::ranges::merge(steady_times, tilted_times, std::back_inserter(times));
+    times.erase(std::unique(std::begin(times), std::end(times)),
+                std::end(times));
+    rows += make_qos_csv_row(split_steady_tilted_algo::get_algo_name(),
+                             num_sites, T, times);
+  }
+  return rows;
+}
+
+template <typename dstream_algo>
+void add_qos_jobs(std::vector<std::function<std::string()>> &jobs,
+                  const std::vector<uint32_t> &checkpoints) {
+  jobs.push_back([&] { return evaluate_qos<dstream_algo, 4096>(checkpoints); });
+  jobs.push_back([&] { return evaluate_qos<dstream_algo, 1024>(checkpoints); });
+  jobs.push_back([&] { return evaluate_qos<dstream_algo, 256>(checkpoints); });
+  jobs.push_back([&] { return evaluate_qos<dstream_algo, 64>(checkpoints); });
+}
+
+// jobs run in parallel across algorithms and S, output stays in job order
+int run_qos_evaluator(const qos_options &options) {
+  if (!check_gap_metrics()) {
+    std::cerr << "gap metrics differ from hand-computed values\n";
+    return 1;
+  }
+
+  const auto checkpoints = make_qos_checkpoints(options);
+
+  std::vector<std::function<std::string()>> jobs;
+  add_qos_jobs<ring_buffer_algo>(jobs, checkpoints);
+  add_qos_jobs<dstream_steady_algo_>(jobs, checkpoints);
+  add_qos_jobs<dstream_stretched_algo>(jobs, checkpoints);
+  add_qos_jobs<dstream_tilted_algo>(jobs, checkpoints);
+  add_qos_jobs<dstream_hybrid_algo>(jobs, checkpoints);
+  jobs.push_back([&] { return evaluate_split_qos<4096>(checkpoints); });
+  jobs.push_back([&] { return evaluate_split_qos<1024>(checkpoints); });
+  jobs.push_back([&] { return evaluate_split_qos<256>(checkpoints); });
+  jobs.push_back([&] { return evaluate_split_qos<64>(checkpoints); });
+  add_qos_jobs<dstream_circular_algo_>(jobs, checkpoints);
+  add_qos_jobs<dstream_compressing_algo_>(jobs, checkpoints);
+
+  std::vector<std::string> results(jobs.size());
+  std::atomic<size_t> next_job{};
+  {
+    std::vector<std::jthread> workers;
+    for (uint32_t i = 0; i < options.num_threads; ++i)
+      workers.emplace_back([&] {
+        for (size_t j; (j = next_job++) < jobs.size();)
+          results[j] = jobs[j]();
+      });
+  }
+
+  std::cout << make_qos_csv_header();
+  for (const auto &rows : results)
+    std::cout << rows;
+  return 0;
+}
+
+// usage:
+//   qos [--num-items N] [--points-per-doubling N] [--threads N]
+int run_qos_cli(const int argc, char *argv[]) {
+  qos_options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--num-items" && has_value)
+      options.num_items = std::stoul(argv[++i]);
+    else if (arg == "--points-per-doubling" && has_value)
+      options.points_per_doubling = std::stoul(argv[++i]);
+    else if (arg == "--threads" && has_value)
+      options.num_threads = std::stoul(argv[++i]);
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--num-items N] [--points-per-doubling N]"
+                   " [--threads N]\n";
+      return 2;
+    }
+  }
+  if (!options.num_items || !options.points_per_doubling ||
+      !options.num_threads) {
+    std::cerr << "options must be positive\n";
+    return 2;
+  }
+
+  return run_qos_evaluator(options);
+}
+#endif // #ifndef QOS_EVALUATOR_HPP_INCLUDE
@@ -0,0 +1,176 @@
+#pragma once
+#ifndef REGRESSION_HPP_INCLUDE
+#define REGRESSION_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "./aux/csv_table.hpp"
+#include "./aux/mann_whitney_u.hpp"
+#include "./benchmark.hpp"
+#include "./footprint.hpp"
+
+struct regression_options {
+  std::string baseline_path;
+  double threshold = 0.10; // flag slowdowns beyond this fraction...
+  double alpha = 0.01;     // ... that are also significant at this level
+  bool two_sided = false;  // also flag speedups, i.e., any shift
+
+  // merge static sizes from this footprint CSV into output, without baseline
+  std::string footprint_path;
+};
+
+// configurations are aligned on algo, dtype, S, and item count
+using regression_key_t =
+    std::tuple<std::string, std::string, uint32_t, uint32_t>;
+using regression_samples_t = std::map<regression_key_t, std::vector<double>>;
+
+double regression_median(std::vector<double> values) {
+  std::ranges::sort(values);
+  const size_t n = values.size();
+  return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+bool load_regression_baseline(const std::string &path,
+                              regression_samples_t &samples) {
+  std::ifstream file(path);
+  if (!file) {
+    std::cerr << "could not open baseline " << path << '\n';
+    return false;
+  }
+  const csv_table table = read_csv_table(file);
+
+  const auto algo_col = table.find_column("algo_name");
+  const auto dtype_col = table.find_column("data_type");
+  const auto sites_col = table.find_column("num_sites");
+  const auto items_col = table.find_column("num_items");
+  const auto duration_col = table.find_column("duration_s");
+  if (!algo_col || !dtype_col || !sites_col || !items_col || !duration_col) {
+    std::cerr << "baseline " << path << " is missing required columns\n";
+    return false;
+  }
+
+  for (const auto &row : table.rows) {
+    if (row.size() != table.header.size()) {
+      std::cerr << "skipping malformed baseline row\n";
+      continue;
+    }
+    const regression_key_t key{row[*algo_col], row[*dtype_col],
+                               std::stoul(row[*sites_col]),
+                               std::stoul(row[*items_col])};
+    samples[key].push_back(std::stod(row[*duration_col]));
+  }
+  return true;
+}
+
+int run_regression_benchmark(const regression_options &options) {
+  regression_samples_t baseline;
+  if (!load_regression_baseline(options.baseline_path, baseline))
+    return 2;
+
+  std::vector<benchmark_result> results;
+  benchmark_algos(std::back_inserter(results));
+
+  // still emit CSV, so a passing run can become the next baseline
+  regression_samples_t current;
+  std::cout << benchmark_result::make_csv_header();
+  for (const auto &result : results) {
+    std::cout << result;
+    const regression_key_t key{std::string{result.algo_name},
+                               std::string{result.data_type},
+                               result.num_sites, result.num_items};
+    current[key].push_back(result.duration_s);
+  }
+
+  std::cerr << std::format("{} check against {} "
+                           "(threshold {}{:.1f}%, alpha {})\n",
+                           options.two_sided ? "shift" : "regression",
+                           options.baseline_path,
+                           options.two_sided ? "+/-" : "+",
+                           options.threshold * 100, options.alpha);
+  uint32_t num_compared{};
+  uint32_t num_missing{};
+  uint32_t num_flagged{};
+  for (const auto &[key, durations] : current) {
+    const auto it = baseline.find(key);
+    if (it == std::end(baseline)) {
+      ++num_missing;
+      continue;
+    }
+    ++num_compared;
+
+    const double before = regression_median(it->second);
+    const double after = regression_median(durations);
+    const double slowdown = after / before - 1.0;
+    const double p_slower = mann_whitney_u_greater(durations, it->second);
+    const double p_faster = mann_whitney_u_greater(it->second, durations);
+    const double p = options.two_sided
+                         ? std::min(1.0, 2 * std::min(p_slower, p_faster))
+                         : p_slower;
+    const double shift = options.two_sided ? std::abs(slowdown) : slowdown;
+    if (shift > options.threshold && p < options.alpha) {
+      ++num_flagged;
+      const auto &[algo_name, data_type, num_sites, num_items] = key;
+      std::cerr << std::format("  {} {} [{}] S={} n={}: "
+                               "median {:.3e}s -> {:.3e}s ({:+.1f}%), "
+                               "p={:.2e}\n",
+                               options.two_sided ? "SHIFT" : "REGRESSION",
+                               algo_name, data_type, num_sites, num_items,
+                               before, after, slowdown * 100, p);
+    }
+  }
+  std::cerr << std::format("compared {} configurations "
+                           "({} missing from baseline): {} flagged\n",
+                           num_compared, num_missing, num_flagged);
+
+  return num_flagged ? 1 : 0;
+}
+
+// usage:
+//   main [--baseline FILE [--threshold FRACTION] [--alpha P] [--two-sided]]
+//   main --footprint FILE
+int run_benchmark_cli(const int argc, char *argv[]) {
+  regression_options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--baseline" && has_value)
+      options.baseline_path = argv[++i];
+    else if (arg == "--threshold" && has_value)
+      options.threshold = std::stod(argv[++i]);
+    else if (arg == "--alpha" && has_value)
+      options.alpha = std::stod(argv[++i]);
+    else if (arg == "--two-sided")
+      options.two_sided = true;
+    else if (arg == "--footprint" && has_value)
+      options.footprint_path = argv[++i];
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--baseline FILE [--threshold FRACTION] [--alpha P]"
+                   " [--two-sided]] | [--footprint FILE]\n";
+      return 2;
+    }
+  }
+  if (!options.footprint_path.empty() && !options.baseline_path.empty()) {
+    std::cerr << "--footprint cannot be combined with --baseline\n";
+    return 2;
+  }
+
+  if (!options.footprint_path.empty())
+    return run_footprint_benchmark(options.footprint_path);
+  else if (options.baseline_path.empty())
+    return run_benchmark();
+  else
+    return run_regression_benchmark(options);
+}
+#endif // #ifndef REGRESSION_HPP_INCLUDE
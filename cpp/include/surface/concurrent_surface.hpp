@@ -0,0 +1,61 @@
+#pragma once
+#ifndef SURFACE_CONCURRENT_SURFACE_HPP_INCLUDE
+#define SURFACE_CONCURRENT_SURFACE_HPP_INCLUDE
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Lock-free multi-producer surface.
+//
+// Producers claim T with an atomic fetch_add and compute the site with the
+// algorithm's `_assign_storage_site`. Each site packs a version stamp (T + 1,
+// with zero meaning unwritten) into the high half of a 64-bit word and the
+// value into the low half, so that same-site races resolve to the newest T
+// with a single compare-exchange.
+template <typename algo, typename dtype, uint32_t num_sites>
+struct concurrent_surface {
+  static_assert(std::is_trivially_copyable_v<dtype>);
+  static_assert(sizeof(dtype) <= sizeof(uint32_t));
+
+  std::atomic<uint32_t> T{};
+  std::array<std::atomic<uint64_t>, num_sites> sites{};
+
+  uint32_t ingest(const dtype value) {
+    const uint32_t T_ = T.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t k = algo::_assign_storage_site(num_sites, T_);
+    if (k != num_sites)
+      store(k, T_, value);
+    return T_;
+  }
+
+  void store(const uint32_t k, const uint32_t T_, const dtype value) {
+    uint32_t bits{};
+    std::memcpy(&bits, &value, sizeof(dtype));
+    const uint64_t desired = ((uint64_t{T_} + 1) << 32) | bits;
+
+    auto &site = sites[k];
+    uint64_t expected = site.load(std::memory_order_relaxed);
+    // give up as soon as a newer T has landed on this site
+    while ((expected >> 32) < (desired >> 32) &&
+           !site.compare_exchange_weak(expected, desired,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed))
+      ;
+  }
+
+  // stamp is T + 1 of the resident item, or zero if site is unwritten
+  uint32_t get_stamp(const uint32_t k) const {
+    return sites[k].load(std::memory_order_acquire) >> 32;
+  }
+
+  dtype get_value(const uint32_t k) const {
+    const uint32_t bits = sites[k].load(std::memory_order_acquire);
+    dtype value;
+    std::memcpy(&value, &bits, sizeof(dtype));
+    return value;
+  }
+};
+#endif // #ifndef SURFACE_CONCURRENT_SURFACE_HPP_INCLUDE
@@ -0,0 +1,109 @@
+#pragma once
+#ifndef SURFACE_DIRTY_SURFACE_HPP_INCLUDE
+#define SURFACE_DIRTY_SURFACE_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../aux/site_storage_t.hpp"
+#include "../aux/varint.hpp"
+
+// Surface storage with an optional dirty bitmap, for incremental replication.
+//
+// export_delta emits sites changed since the previous export as runs, each
+// encoded as varint gap (sites skipped since the previous run's end), varint
+// run length, then the run's values in raw bytes. Without tracking, every
+// export is a full snapshot in the same format, i.e., one run of all sites.
+template <typename dtype, uint32_t num_sites, bool track_dirty = true>
+class dirty_surface {
+  static_assert(std::is_trivially_copyable_v<dtype>);
+  static constexpr uint32_t num_words = (num_sites + 63) / 64;
+  using dirty_t = std::conditional_t<track_dirty,
+                                     std::array<uint64_t, num_words>,
+                                     std::array<uint64_t, 0>>;
+
+  site_storage_t<dtype, num_sites> storage{};
+  dirty_t dirty{};
+
+  // first site at or after k whose dirty bit equals `set`, or num_sites
+  uint32_t find_site(const uint32_t k, const bool set) const {
+    if (k >= num_sites) // e.g., after a run that ends at the last site
+      return num_sites;
+    uint32_t w = k / 64;
+    uint64_t word = (set ? dirty[w] : ~dirty[w]) & (~uint64_t{} << (k % 64));
+    while (!word && ++w < num_words)
+      word = set ? dirty[w] : ~dirty[w];
+    return w < num_words ? std::min(w * 64 + std::countr_zero(word), num_sites)
+                         : num_sites;
+  }
+
+  template <typename OutputIt>
+  OutputIt export_run(OutputIt out, const uint32_t begin, const uint32_t end) {
+    for (uint32_t k = begin; k < end; ++k) {
+      const dtype value = storage[k];
+      uint8_t bytes[sizeof(dtype)];
+      std::memcpy(bytes, &value, sizeof(dtype));
+      out = std::copy(std::begin(bytes), std::end(bytes), out);
+    }
+    return out;
+  }
+
+public:
+  static constexpr bool is_tracked() { return track_dirty; }
+
+  __attribute__((always_inline)) void store(const uint32_t k,
+                                            const dtype value) {
+    storage[k] = value;
+    if constexpr (track_dirty)
+      dirty[k / 64] |= uint64_t{1} << (k % 64);
+  }
+
+  dtype load(const uint32_t k) const { return storage[k]; }
+
+  // emits the delta since the previous export and starts a new checkpoint
+  template <typename OutputIt> OutputIt export_delta(OutputIt out) {
+    if constexpr (!track_dirty) {
+      out = write_varint(out, 0);
+      out = write_varint(out, num_sites);
+      return export_run(out, 0, num_sites);
+    } else {
+      uint32_t prev_end = 0;
+      for (uint32_t begin = find_site(0, true); begin < num_sites;
+           begin = find_site(prev_end, true)) {
+        const uint32_t end = find_site(begin, false);
+        out = write_varint(out, begin - prev_end);
+        out = write_varint(out, end - begin);
+        out = export_run(out, begin, end);
+        prev_end = end;
+      }
+      dirty.fill(0);
+      return out;
+    }
+  }
+
+  // applies a delta from export_delta, e.g., on the aggregator's replica
+  template <typename InputIt> void apply_delta(InputIt in, const InputIt end) {
+    uint32_t k = 0;
+    while (in != end) {
+      k += read_varint(in);
+      const uint32_t run_end = k + read_varint(in);
+      for (; k < run_end; ++k) {
+        uint8_t bytes[sizeof(dtype)];
+        for (auto &byte : bytes)
+          byte = *in++;
+        dtype value;
+        std::memcpy(&value, bytes, sizeof(dtype));
+        store(k, value);
+      }
+    }
+  }
+
+  static constexpr uint32_t get_memory_bytes() {
+    return sizeof(site_storage_t<dtype, num_sites>) + sizeof(dirty_t);
+  }
+};
+#endif // #ifndef SURFACE_DIRTY_SURFACE_HPP_INCLUDE
@@ -0,0 +1,155 @@
+#pragma once
+#ifndef SURFACE_DOWNSIZE_SURFACE_HPP_INCLUDE
+#define SURFACE_DOWNSIZE_SURFACE_HPP_INCLUDE
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "../aux/smallest_unsigned_t.hpp"
+
+// For each site of a size num_sites / 2 surface at time T, the site of the
+// size num_sites surface at time T holding the same item, or num_sites if the
+// smaller surface's site is still empty or its item was already discarded by
+// the larger surface. Steady and stretched retention nest, so the latter
+// never happens for them; tilted retention does not always nest.
+//
+// Built by scanning ingest times backward from T, two kernel calls per step,
+// until the age of the smaller surface's oldest retained item, independent of
+// how many surfaces the plan is then applied to. That age can be most of T,
+// e.g., for steady retention, so for a single surface the plan costs about as
+// much as rebuilding it by re-ingesting; downsizing pays off when one plan is
+// shared across a population.
+template <uint32_t num_sites> struct downsize_plan {
+  static_assert(num_sites >= 2 && num_sites % 2 == 0);
+  using site_t = smallest_unsigned_t<num_sites>::type;
+
+  std::array<site_t, num_sites / 2> source;
+  std::bitset<num_sites / 2> lost; // item discarded by the larger surface
+  uint32_t num_lost;
+};
+
+template <typename dstream_algo, uint32_t num_sites>
+downsize_plan<num_sites> make_downsize_plan(const uint32_t T) {
+  constexpr uint32_t half_sites = num_sites / 2;
+  downsize_plan<num_sites> plan;
+  plan.source.fill(num_sites);
+  plan.num_lost = 0;
+
+  std::bitset<half_sites> resolved;
+  std::bitset<num_sites> overwritten; // sites with a more recent ingest
+  uint32_t num_unresolved = half_sites;
+  for (uint32_t t = T; t-- > 0 && num_unresolved;) {
+    const uint32_t k_half = dstream_algo::_assign_storage_site(half_sites, t);
+    const uint32_t k = dstream_algo::_assign_storage_site(num_sites, t);
+    if (k_half != half_sites && !resolved.test(k_half)) {
+      if (k == num_sites || overwritten.test(k)) {
+        plan.lost.set(k_half);
+        ++plan.num_lost;
+      } else
+        plan.source[k_half] = k;
+      resolved.set(k_half);
+      --num_unresolved;
+    }
+    if (k != num_sites)
+      overwritten.set(k);
+  }
+  return plan;
+}
+
+// moves each item to its site under the plan, using no buffer beyond one
+// item, then writes fill_value into sites without a source, i.e., lost or
+// still empty
+template <typename dtype, uint32_t num_sites>
+void apply_downsize_plan(const downsize_plan<num_sites> &plan,
+                         dtype *const surface, const dtype fill_value) {
+  constexpr uint32_t half_sites = num_sites / 2;
+  const auto &source = plan.source;
+
+  std::bitset<half_sites> pending;
+  std::bitset<num_sites> is_source; // value still needed by a pending move
+  for (uint32_t k = 0; k < half_sites; ++k) {
+    if (source[k] != num_sites && source[k] != k) {
+      pending.set(k);
+      is_source.set(source[k]);
+    }
+  }
+
+  // the plan is injective, so moves form chains and cycles;
+  // unwind each chain from the site whose value nobody needs...
+  for (uint32_t k = 0; k < half_sites; ++k) {
+    if (!pending.test(k) || is_source.test(k))
+      continue;
+    uint32_t dest = k;
+    while (true) {
+      const uint32_t src = source[dest];
+      surface[dest] = surface[src];
+      pending.reset(dest);
+      is_source.reset(src);
+      if (src >= half_sites || !pending.test(src))
+        break;
+      dest = src;
+    }
+  }
+
+  // ... then rotate remaining cycles through a temporary
+  for (uint32_t k = 0; k < half_sites; ++k) {
+    if (!pending.test(k))
+      continue;
+    const dtype temp = surface[k];
+    uint32_t dest = k;
+    while (true) {
+      const uint32_t src = source[dest];
+      pending.reset(dest);
+      if (src == k) {
+        surface[dest] = temp;
+        break;
+      }
+      surface[dest] = surface[src];
+      dest = src;
+    }
+  }
+
+  for (uint32_t k = 0; k < half_sites; ++k)
+    if (source[k] == num_sites)
+      surface[k] = fill_value;
+}
+
+// Converts a population of size num_sites surfaces, all at time T and laid
+// out contiguously, into size num_sites / 2 surfaces in the leading half of
+// the same buffer, retaining exactly the items the smaller surfaces would.
+// Sites whose item could not be recovered, flagged in the returned plan's
+// lost mask, hold fill_value instead, as do sites still empty.
+template <typename dstream_algo, uint32_t num_sites, typename dtype>
+downsize_plan<num_sites> downsize_population(const std::span<dtype> population,
+                                             const uint32_t T,
+                                             const dtype fill_value) {
+  static_assert(std::is_trivially_copyable_v<dtype>);
+  constexpr uint32_t half_sites = num_sites / 2;
+  assert(population.size() % num_sites == 0);
+
+  const auto plan = make_downsize_plan<dstream_algo, num_sites>(T);
+
+  const size_t population_size = population.size() / num_sites;
+  for (size_t i = 0; i < population_size; ++i) {
+    dtype *const surface = population.data() + i * num_sites;
+    apply_downsize_plan<dtype, num_sites>(plan, surface, fill_value);
+    if (i)
+      std::memmove(population.data() + i * half_sites, surface,
+                   sizeof(dtype) * half_sites);
+  }
+  return plan;
+}
+
+template <typename dstream_algo, uint32_t num_sites, typename dtype>
+downsize_plan<num_sites> downsize_surface(std::array<dtype, num_sites> &surface,
+                                          const uint32_t T,
+                                          const dtype fill_value) {
+  return downsize_population<dstream_algo, num_sites>(
+      std::span<dtype>{surface}, T, fill_value);
+}
+#endif // #ifndef SURFACE_DOWNSIZE_SURFACE_HPP_INCLUDE
@@ -0,0 +1,23 @@
+#pragma once
+#ifndef SURFACE_HEAP_ARRAY_HPP_INCLUDE
+#define SURFACE_HEAP_ARRAY_HPP_INCLUDE
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+// plain std::array site storage, heap-allocated as it outgrows the stack
+template <typename dtype, uint32_t num_sites> class heap_array {
+  // bypass zero-initialization
+  std::unique_ptr<std::array<dtype, num_sites>> storage =
+      std::make_unique_for_overwrite<std::array<dtype, num_sites>>();
+
+public:
+  static std::string_view get_storage_name() { return "array"; }
+
+  dtype *data() { return storage->data(); }
+
+  dtype &operator[](const uint32_t k) { return (*storage)[k]; }
+};
+#endif // #ifndef SURFACE_HEAP_ARRAY_HPP_INCLUDE
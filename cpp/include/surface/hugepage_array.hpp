@@ -0,0 +1,50 @@
+#pragma once
+#ifndef SURFACE_HUGEPAGE_ARRAY_HPP_INCLUDE
+#define SURFACE_HUGEPAGE_ARRAY_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+
+#include <sys/mman.h>
+
+// site storage mapped anonymously and advised for transparent huge pages, so
+// scattered site writes across a large surface touch few TLB entries
+template <typename dtype, uint32_t num_sites> class hugepage_array {
+  static constexpr size_t huge_page_bytes = size_t{2} << 20;
+  static constexpr size_t storage_bytes =
+      (sizeof(dtype) * num_sites + huge_page_bytes - 1) & -huge_page_bytes;
+  // slack to align storage to a huge page boundary
+  static constexpr size_t mapping_bytes = storage_bytes + huge_page_bytes;
+
+  void *mapping;
+  dtype *storage;
+
+public:
+  hugepage_array() {
+    mapping = mmap(nullptr, mapping_bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+      throw std::bad_alloc{};
+
+    const auto address = reinterpret_cast<uintptr_t>(mapping);
+    storage = reinterpret_cast<dtype *>((address + huge_page_bytes - 1) &
+                                        -huge_page_bytes);
+#ifdef MADV_HUGEPAGE
+    madvise(storage, storage_bytes, MADV_HUGEPAGE); // best effort
+#endif
+  }
+
+  ~hugepage_array() { munmap(mapping, mapping_bytes); }
+
+  hugepage_array(const hugepage_array &) = delete;
+  hugepage_array &operator=(const hugepage_array &) = delete;
+
+  static std::string_view get_storage_name() { return "hugepage"; }
+
+  dtype *data() { return storage; }
+
+  dtype &operator[](const uint32_t k) { return storage[k]; }
+};
+#endif // #ifndef SURFACE_HUGEPAGE_ARRAY_HPP_INCLUDE
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef SURFACE_POPULATION_ARRAY_HPP_INCLUDE
+#define SURFACE_POPULATION_ARRAY_HPP_INCLUDE
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+// sites of num_surfaces equal-sized surfaces, back to back in one heap block,
+// so a write is addressed by a flat offset surface * num_sites + site
+template <typename dtype, uint32_t num_sites> class population_array {
+  uint32_t num_surfaces;
+  // bypass zero-initialization
+  std::unique_ptr<dtype[]> storage;
+
+public:
+  explicit population_array(const uint32_t num_surfaces)
+      : num_surfaces(num_surfaces),
+        storage(std::make_unique_for_overwrite<dtype[]>(uint64_t{num_sites} *
+                                                        num_surfaces)) {
+    // flat offsets are 32-bit
+    assert(uint64_t{num_sites} * num_surfaces <= uint64_t{1} << 32);
+  }
+
+  uint32_t get_num_surfaces() const { return num_surfaces; }
+
+  uint64_t get_memory_bytes() const {
+    return uint64_t{sizeof(dtype)} * num_sites * num_surfaces;
+  }
+
+  dtype *data() { return storage.get(); }
+
+  dtype *surface(const uint32_t i) {
+    return storage.get() + uint64_t{num_sites} * i;
+  }
+};
+#endif // #ifndef SURFACE_POPULATION_ARRAY_HPP_INCLUDE
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef SURFACE_RETAINED_TIMES_HPP_INCLUDE
+#define SURFACE_RETAINED_TIMES_HPP_INCLUDE
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+#include "../aux/smallest_unsigned_t.hpp"
+
+// Ingest times retained by a site-based algorithm, kept in ingest order as a
+// doubly linked list over sites. Each ingest unlinks the overwritten site and
+// appends it as newest, so the order never needs recomputing.
+template <typename dstream_algo, uint32_t num_sites> class retained_times {
+  using site_t = smallest_unsigned_t<num_sites>::type;
+  static constexpr site_t none = num_sites; // list sentinel
+
+  std::array<uint32_t, num_sites> times;
+  std::array<site_t, num_sites + 1> prev; // indexed by site, or none for head
+  std::array<site_t, num_sites + 1> next; // indexed by site, or none for tail
+  std::bitset<num_sites> occupied;
+  uint32_t num_retained{};
+  uint32_t T{};
+
+  void unlink(const site_t k) {
+    next[prev[k]] = next[k];
+    prev[next[k]] = prev[k];
+  }
+
+  void append(const site_t k) {
+    const site_t tail = prev[none];
+    next[tail] = k;
+    prev[k] = tail;
+    next[k] = none;
+    prev[none] = k;
+  }
+
+public:
+  retained_times() {
+    prev[none] = none;
+    next[none] = none;
+  }
+
+  void ingest() {
+    const uint32_t k = dstream_algo::_assign_storage_site(num_sites, T);
+    if (k != num_sites) {
+      if (occupied.test(k))
+        unlink(k);
+      else {
+        occupied.set(k);
+        ++num_retained;
+      }
+      append(k);
+      times[k] = T;
+    }
+    ++T;
+  }
+
+  uint32_t get_num_ingested() const { return T; }
+
+  uint32_t get_num_retained() const { return num_retained; }
+
+  // visits retained ingest times, oldest first
+  template <typename F> void for_each(F f) const {
+    for (site_t k = next[none]; k != none; k = next[k])
+      f(times[k]);
+  }
+};
+#endif // #ifndef SURFACE_RETAINED_TIMES_HPP_INCLUDE
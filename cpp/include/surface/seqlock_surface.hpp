@@ -0,0 +1,77 @@
+#pragma once
+#ifndef SURFACE_SEQLOCK_SURFACE_HPP_INCLUDE
+#define SURFACE_SEQLOCK_SURFACE_HPP_INCLUDE
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+// Single-writer surface whose (T, sites) image other threads can copy out
+// without blocking ingest.
+//
+// The writer makes the sequence counter odd around each site store and even
+// again after. A reader copies T and the sites between two loads of the
+// counter, and keeps the copy only if both loads are equal and even, i.e., no
+// store landed during the copy. Discarded items advance T without touching
+// the counter, so they never tear a snapshot. Sites and T are accessed
+// through relaxed atomics, which compile to plain loads and stores, so racing
+// copies are well defined, as in Boehm's "Can seqlocks get along with
+// programming language memory models?"
+template <typename algo, typename dtype, uint32_t num_sites>
+class seqlock_surface {
+  static_assert(std::is_trivially_copyable_v<dtype>);
+  static_assert(std::atomic_ref<dtype>::is_always_lock_free);
+
+  std::atomic<uint32_t> seq{};
+  std::atomic<uint32_t> T{};
+  alignas(std::atomic_ref<dtype>::required_alignment)
+      std::array<dtype, num_sites> sites{};
+
+  // atomic_ref<const T> is C++26, but a relaxed load never writes
+  dtype load_site(const uint32_t k) const {
+    auto &site = const_cast<dtype &>(sites[k]);
+    return std::atomic_ref<dtype>{site}.load(std::memory_order_relaxed);
+  }
+
+public:
+  struct snapshot {
+    uint32_t T;
+    std::array<dtype, num_sites> sites;
+  };
+
+  // writer only
+  void ingest(const dtype value) {
+    const uint32_t T_ = T.load(std::memory_order_relaxed);
+    const uint32_t k = algo::_assign_storage_site(num_sites, T_);
+    if (k != num_sites) {
+      const uint32_t seq_ = seq.load(std::memory_order_relaxed);
+      seq.store(seq_ + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      std::atomic_ref<dtype>{sites[k]}.store(value, std::memory_order_relaxed);
+      T.store(T_ + 1, std::memory_order_relaxed);
+      seq.store(seq_ + 2, std::memory_order_release);
+    } else
+      T.store(T_ + 1, std::memory_order_relaxed);
+  }
+
+  // any thread; false if the writer stored a site during the copy
+  bool try_snapshot(snapshot &out) const {
+    const uint32_t seq1 = seq.load(std::memory_order_acquire);
+    if (seq1 & 1)
+      return false;
+
+    out.T = T.load(std::memory_order_relaxed);
+    for (uint32_t k = 0; k < num_sites; ++k)
+      out.sites[k] = load_site(k);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint32_t seq2 = seq.load(std::memory_order_relaxed);
+    return seq1 == seq2;
+  }
+
+  uint32_t get_num_ingested() const {
+    return T.load(std::memory_order_relaxed);
+  }
+};
+#endif // #ifndef SURFACE_SEQLOCK_SURFACE_HPP_INCLUDE
@@ -0,0 +1,3 @@
+#include "../include/benchmark_access_profile.hpp"
+
+int main(int argc, char *argv[]) { return run_access_profile_cli(argc, argv); }
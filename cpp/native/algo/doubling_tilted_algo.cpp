@@ -0,0 +1,4 @@
+#include "../../include/benchmark.hpp"
+
+template void
+benchmark_assign_storage_site<doubling_tilted_algo>(benchmark_output_t);
@@ -0,0 +1,4 @@
+#include "../../include/benchmark.hpp"
+
+template void
+benchmark_assign_storage_site<dstream_circular_algo_>(benchmark_output_t);
@@ -0,0 +1,3 @@
+#include "../include/benchmark_bitops.hpp"
+
+int main() { return run_bitops_benchmark(); }
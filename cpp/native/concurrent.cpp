@@ -0,0 +1,3 @@
+#include "../include/benchmark_concurrent.hpp"
+
+int main() { return run_concurrent_benchmark(); }
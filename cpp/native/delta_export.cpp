@@ -0,0 +1,3 @@
+#include "../include/benchmark_delta_export.hpp"
+
+int main() { return run_delta_export_benchmark(); }
@@ -0,0 +1,3 @@
+#include "../include/benchmark_downsize.hpp"
+
+int main() { return run_downsize_benchmark(); }
@@ -0,0 +1,9 @@
+#include "../include/benchmark.hpp"
+
+// FOOTPRINT_ALGO at FOOTPRINT_NUM_SITES sites of FOOTPRINT_DTYPE, compiled
+// alone into an object whose section and table sizes footprint.sh reports
+extern "C" uint32_t footprint_assign_storage_site(const uint32_t num_items) {
+  using executor = execute_assign_storage_site<
+      FOOTPRINT_DTYPE, FOOTPRINT_NUM_SITES, FOOTPRINT_ALGO>;
+  return executor{}(num_items);
+}
@@ -0,0 +1,87 @@
+#!/bin/bash
+set -euo pipefail  # Exit on any error
+
+# usage: footprint.sh [--tables] footprint/ALGO-DTYPE-S.o...
+#   default: one CSV row of section sizes per object
+#   --tables: one CSV row per lookup table, i.e., per named data object
+# objects built for another target by `make footprint FOOTPRINT_CXX=...
+# FOOTPRINT_CFLAGS=...` need OBJDUMP and SIZE set to matching binutils, e.g.,
+# arm-none-eabi-objdump; see FOOTPRINT_CFLAGS in the Makefile
+
+tables=false
+if [ "${1:-}" = "--tables" ]; then
+    tables=true
+    shift
+fi
+
+# benchmark data_type name of a C++ dtype, as name_value gives it
+dtype_name() {
+    case "$1" in
+        bool) echo bit ;;
+        uint8_t) echo byte ;;
+        uint16_t) echo word ;;
+        uint32_t) echo double word ;;
+        uint64_t) echo quad word ;;
+        *) echo "$1" ;;
+    esac
+}
+
+# text, rodata, data, or bss, by output section prefix
+section_kind() {
+    case "$1" in
+        .text*) echo text ;;
+        .rodata*) echo rodata ;;
+        .data*) echo data ;;
+        .bss*) echo bss ;;
+        *) echo other ;;
+    esac
+}
+
+# named data objects, less guard variables and compiler or library statics, as
+# "section<TAB>hex size<TAB>demangled name"
+list_tables() {
+    "${OBJDUMP:-objdump}" -t -C "$1" \
+    | awk '{ w = length($1) }  # address width, 8 or 16 hex digits
+        substr($0, w + 2, 7) ~ /O/ { print substr($0, w + 10) }' \
+    | sed 's/\t\([0-9a-f]*\) /\t\1\t/' \
+    | grep -v -e $'\tguard variable for ' -e $'\tstd::' -e $'\t\\.' || true
+}
+
+if $tables; then
+    echo "algo_name,data_type,num_sites,table_name,section,table_bytes"
+else
+    echo "algo_name,data_type,num_sites,text_bytes,rodata_bytes,data_bytes,\
+bss_bytes,table_bytes"
+fi
+
+for object in "$@"; do
+    name="$(basename "$object" .o)"
+    algo_name="${name%%-*}"
+    data_type="$(dtype_name "$(echo "$name" | cut -d- -f2)")"
+    num_sites="${name##*-}"
+
+    if $tables; then
+        list_tables "$object" \
+        | while IFS=$'\t' read -r section size symbol; do
+            kind="$(section_kind "$section")"
+            # keep only the variable name, without function or template args
+            echo "$algo_name,$data_type,$num_sites,${symbol##*::},$kind,\
+$((16#$size))"
+        done
+        continue
+    fi
+
+    declare -A bytes=([text]=0 [rodata]=0 [data]=0 [bss]=0 [other]=0)
+    while read -r section size _; do
+        kind="$(section_kind "$section")"
+        bytes[$kind]=$((bytes[$kind] + size))
+    done < <("${SIZE:-size}" -A "$object" | tail -n +3)
+
+    table_bytes=0
+    while IFS=$'\t' read -r _ size _; do
+        table_bytes=$((table_bytes + 16#$size))
+    done < <(list_tables "$object")
+
+    echo "$algo_name,$data_type,$num_sites,${bytes[text]},${bytes[rodata]},\
+${bytes[data]},${bytes[bss]},$table_bytes"
+done
@@ -0,0 +1,3 @@
+#include "../include/benchmark_gather.hpp"
+
+int main() { return run_gather_benchmark(); }
@@ -0,0 +1,3 @@
+#include "../include/benchmark_large_surface.hpp"
+
+int main() { return run_large_surface_benchmark(); }
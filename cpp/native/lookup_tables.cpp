@@ -0,0 +1,3 @@
+#include "../include/benchmark_lookup_tables.hpp"
+
+int main() { return run_lookup_tables_benchmark(); }
@@ -1,3 +1,4 @@
 #include "../include/benchmark.hpp"
+#include "../include/regression.hpp"
 
-int main() { return run_benchmark(); }
+int main(int argc, char *argv[]) { return run_benchmark_cli(argc, argv); }
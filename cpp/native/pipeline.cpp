@@ -0,0 +1,3 @@
+#include "../include/benchmark_pipeline.hpp"
+
+int main() { return run_pipeline_benchmark(); }
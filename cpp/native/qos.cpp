@@ -0,0 +1,3 @@
+#include "../include/qos_evaluator.hpp"
+
+int main(int argc, char *argv[]) { return run_qos_cli(argc, argv); }
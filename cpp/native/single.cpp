@@ -0,0 +1,4 @@
+#include "../include/benchmark.hpp"
+
+// BENCHMARK_ALGO names the algorithm whose translation unit is linked in
+int main() { return run_benchmark_algo<BENCHMARK_ALGO>(); }
@@ -0,0 +1,3 @@
+#include "../include/benchmark_snapshot.hpp"
+
+int main() { return run_snapshot_benchmark(); }
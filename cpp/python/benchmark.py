@@ -0,0 +1,42 @@
+"""Time native batched kernels against downstream's pure-Python path.
+
+Run with `make -C cpp/python benchmark`; prints one CSV row per run.
+"""
+
+import time
+
+import numpy as np
+from downstream import dstream
+
+import dstream_native
+
+
+def benchmark(algo_name: str, S: int, T: np.ndarray) -> None:
+    python_impl = getattr(
+        dstream, f"{algo_name}_algo"
+    ).assign_storage_site_batched
+    native_impl = getattr(
+        dstream_native, f"{algo_name}_assign_storage_site_batched"
+    )
+
+    out = np.empty_like(T)
+    for label, run in [
+        ("python", lambda: python_impl(S, T)),
+        ("native", lambda: native_impl(S, T, out)),
+        ("native_4threads", lambda: native_impl(S, T, out, num_threads=4)),
+    ]:
+        start = time.perf_counter()
+        run()
+        duration_s = time.perf_counter() - start
+        print(f"{algo_name},{S},{T.size},{label},{duration_s}")
+
+    np.testing.assert_array_equal(out, python_impl(S, T))
+
+
+if __name__ == "__main__":
+    print("algo_name,num_sites,num_items,method,duration_s")
+    rng = np.random.default_rng(1)
+    for algo_name in "stretched", "tilted":
+        for S in 64, 256, 1024:
+            T = rng.integers(S, 2**32, size=2**22, dtype=np.int64)
+            benchmark(algo_name, S, T)
@@ -0,0 +1,173 @@
+// CPython extension exposing the hand-tuned batched site kernels, e.g.,
+//   dstream_native.tilted_assign_storage_site_batched(S, T, out, num_threads)
+// writes the site for each T into out (S if discarded) and returns out.
+//
+// T and out are any C-contiguous buffers of 32- or 64-bit integers, e.g.,
+// numpy arrays, read and written in place without copying. The GIL is
+// released while kernels run, optionally split across num_threads threads.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/algo/dstream_stretched_algo.hpp"
+#include "../include/algo/dstream_tilted_algo.hpp"
+
+namespace {
+
+// calls visitor with buffer contents cast to their integer element type
+template <typename Visitor>
+bool visit_int_buffer(const Py_buffer &view, Visitor &&visitor) {
+  std::string_view format = view.format ? view.format : "B";
+  if (!format.empty() && std::string_view{"@=<"}.contains(format.front()))
+    format.remove_prefix(1);
+  if (format.size() != 1)
+    return false;
+
+  const bool is_signed = std::string_view{"ilq"}.contains(format.front());
+  const bool is_unsigned = std::string_view{"ILQ"}.contains(format.front());
+  if (!is_signed && !is_unsigned)
+    return false;
+
+  void *const buf = view.buf;
+  if (view.itemsize == 4 && is_signed)
+    visitor(static_cast<int32_t *>(buf));
+  else if (view.itemsize == 4)
+    visitor(static_cast<uint32_t *>(buf));
+  else if (view.itemsize == 8 && is_signed)
+    visitor(static_cast<int64_t *>(buf));
+  else if (view.itemsize == 8)
+    visitor(static_cast<uint64_t *>(buf));
+  else
+    return false;
+  return true;
+}
+
+// runs kernel over [0, n) in num_threads contiguous chunks, without the GIL;
+// returns false if any T falls outside the 32-bit range kernels support
+template <uint32_t (*kernel)(uint32_t, uint32_t), typename T_t, typename out_t>
+bool assign_storage_site_batched(const uint32_t S, const T_t *T, out_t *out,
+                                 const Py_ssize_t n,
+                                 const uint32_t num_threads) {
+  std::atomic<bool> in_range{true};
+  const auto work = [&](const Py_ssize_t begin, const Py_ssize_t end) {
+    bool chunk_in_range = true;
+    for (Py_ssize_t i = begin; i < end; ++i) {
+      chunk_in_range &= std::in_range<uint32_t>(T[i]);
+      out[i] = kernel(S, static_cast<uint32_t>(T[i]));
+    }
+    if (!chunk_in_range)
+      in_range = false;
+  };
+
+  Py_BEGIN_ALLOW_THREADS;
+  if (num_threads <= 1)
+    work(0, n);
+  else {
+    std::vector<std::jthread> workers;
+    const Py_ssize_t chunk = (n + num_threads - 1) / num_threads;
+    for (Py_ssize_t begin = 0; begin < n; begin += chunk)
+      workers.emplace_back(work, begin, std::min(begin + chunk, n));
+  } // jthreads join on scope exit
+  Py_END_ALLOW_THREADS;
+
+  return in_range;
+}
+
+template <uint32_t (*kernel)(uint32_t, uint32_t)>
+PyObject *py_assign_storage_site_batched(PyObject *, PyObject *args,
+                                         PyObject *kwargs) {
+  static const char *keywords[] = {"S", "T", "out", "num_threads", nullptr};
+  uint32_t S;
+  PyObject *T_obj;
+  PyObject *out_obj;
+  uint32_t num_threads = 1;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "IOO|I",
+                                   const_cast<char **>(keywords), &S, &T_obj,
+                                   &out_obj, &num_threads))
+    return nullptr;
+
+  if (S != 64 && S != 256 && S != 1024 && S != 4096) {
+    PyErr_SetString(PyExc_ValueError, "S must be 64, 256, 1024, or 4096");
+    return nullptr;
+  }
+
+  Py_buffer T_view;
+  if (PyObject_GetBuffer(T_obj, &T_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+    return nullptr;
+  Py_buffer out_view;
+  if (PyObject_GetBuffer(out_obj, &out_view,
+                         PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE)) {
+    PyBuffer_Release(&T_view);
+    return nullptr;
+  }
+
+  const auto release = [&]() {
+    PyBuffer_Release(&out_view);
+    PyBuffer_Release(&T_view);
+  };
+
+  const Py_ssize_t n = T_view.itemsize ? T_view.len / T_view.itemsize : 0;
+  if (!out_view.itemsize || out_view.len / out_view.itemsize != n) {
+    release();
+    PyErr_SetString(PyExc_ValueError, "T and out must have equal lengths");
+    return nullptr;
+  }
+
+  bool valid_formats = false;
+  bool in_range = true;
+  visit_int_buffer(T_view, [&](const auto *T) {
+    valid_formats = visit_int_buffer(out_view, [&](auto *out) {
+      in_range = assign_storage_site_batched<kernel>(S, T, out, n,
+                                                     num_threads);
+    });
+  });
+  release();
+
+  if (!valid_formats) {
+    PyErr_SetString(PyExc_ValueError,
+                    "T and out must hold 32- or 64-bit integers");
+    return nullptr;
+  } else if (!in_range) {
+    PyErr_SetString(PyExc_ValueError, "T must be in [0, 2**32)");
+    return nullptr;
+  }
+
+  Py_INCREF(out_obj);
+  return out_obj;
+}
+
+PyMethodDef dstream_native_methods[] = {
+    {"stretched_assign_storage_site_batched",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(
+         py_assign_storage_site_batched<_dstream_stretched_assign_storage_site>)),
+     METH_VARARGS | METH_KEYWORDS,
+     "stretched_assign_storage_site_batched(S, T, out, num_threads=1)"},
+    {"tilted_assign_storage_site_batched",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(
+         py_assign_storage_site_batched<_dstream_tilted_assign_storage_site>)),
+     METH_VARARGS | METH_KEYWORDS,
+     "tilted_assign_storage_site_batched(S, T, out, num_threads=1)"},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyModuleDef dstream_native_module = {
+    PyModuleDef_HEAD_INIT,
+    "dstream_native",
+    "Native batched dstream site kernels.",
+    -1,
+    dstream_native_methods,
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit_dstream_native() {
+  return PyModule_Create(&dstream_native_module);
+}
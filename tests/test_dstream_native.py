@@ -0,0 +1,56 @@
+"""Compare native batched kernels with downstream's pure-Python path.
+
+Build the extension first with `make -C cpp/python`. Otherwise, every test
+here skips, as in CI's test-pylib job, which does not build the extension.
+Timings against the pure-Python path are in cpp/python/benchmark.py.
+"""
+
+import os
+import sys
+
+import pytest
+
+np = pytest.importorskip("numpy")
+dstream = pytest.importorskip("downstream.dstream")
+
+sys.path.insert(
+    0, os.path.join(os.path.dirname(__file__), "..", "cpp", "python")
+)
+dstream_native = pytest.importorskip("dstream_native")
+
+
+@pytest.mark.parametrize("algo_name", ["stretched", "tilted"])
+@pytest.mark.parametrize("S", [64, 256, 1024, 4096])
+@pytest.mark.parametrize("dtype", [np.int64, np.uint32])
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_assign_storage_site_batched(algo_name, S, dtype, num_threads):
+    T = np.concatenate(
+        [
+            np.arange(4 * S),
+            np.random.randint(0, 2**32, size=10_000, dtype=np.int64),
+        ],
+    ).astype(dtype)
+    expected = getattr(
+        dstream, f"{algo_name}_algo"
+    ).assign_storage_site_batched(S, T)
+
+    out = np.empty_like(T)
+    native = getattr(
+        dstream_native, f"{algo_name}_assign_storage_site_batched"
+    )
+    assert native(S, T, out, num_threads=num_threads) is out
+    np.testing.assert_array_equal(out, expected)
+
+
+def test_assign_storage_site_batched_invalid():
+    T = np.arange(10, dtype=np.int64)
+    native = dstream_native.tilted_assign_storage_site_batched
+    with pytest.raises(ValueError):
+        native(100, T, np.empty_like(T))  # unsupported S
+    with pytest.raises(ValueError):
+        native(64, T, np.empty(5, dtype=np.int64))  # length mismatch
+    with pytest.raises(ValueError):
+        native(64, T.astype(np.float64), np.empty_like(T))  # not integers
+    with pytest.raises(ValueError):
+        native(64, T - 1, np.empty_like(T))  # negative T
+